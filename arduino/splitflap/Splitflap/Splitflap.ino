@@ -44,6 +44,13 @@
 #include "src/basic_io_config.h"
 #endif
 
+#if defined(__AVR_ATmega168__) || defined(__AVR_ATmega328P__)
+// The module bank is most of an Uno's 2 KB of RAM: 701 bytes for 12 modules with the default features (see config.h),
+// which leaves the rest for the serial and NeoPixel buffers and the stack. Fail the build rather than let it creep up
+// unnoticed.
+static_assert(sizeof(modules) <= 56 * NUM_MODULES + 32, "Module state has outgrown the RAM budget for ATmega328 boards");
+#endif
+
 #if NEOPIXEL_DEBUGGING_ENABLED
 #include <Adafruit_NeoPixel.h>
 #endif
@@ -171,9 +178,9 @@ void setup() {
 
   for (uint8_t i = 0; i < NUM_MODULES; i++) {
     recv_buffer[i] = 0;
-    modules[i]->Init();
+    modules.Init(i);
 #if !SENSOR_TEST
-    modules[i]->GoHome();
+    modules.GoHome(i);
 #endif
   }
 
@@ -206,7 +213,7 @@ bool disabled = false;
 
 void disableAll(char* message) {
   for (uint8_t i = 0; i < NUM_MODULES; i++) {
-    modules[i]->Disable();
+    modules.Disable(i);
   }
   motor_sensor_io();
 
@@ -229,21 +236,20 @@ inline void run_iteration() {
     uint32_t iterationStartMillis = millis();
     boolean all_idle = true;
     boolean all_stopped = true;
+    modules.Update();
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
-      modules[i]->Update();
-      bool is_idle = modules[i]->state == PANIC
-        || modules[i]->state == STATE_DISABLED
-        || modules[i]->state == LOOK_FOR_HOME
-        || modules[i]->state == SENSOR_ERROR
-        || (modules[i]->state == NORMAL && modules[i]->current_accel_step == 0);
+      bool is_idle = modules.state[i] == PANIC
+        || modules.state[i] == STATE_DISABLED
+        || modules.state[i] == LOOK_FOR_HOME
+        || modules.state[i] == SENSOR_ERROR
+        || (modules.state[i] == NORMAL && modules.current_accel_step[i] == 0);
 
-      bool is_stopped = modules[i]->state == PANIC
-        || modules[i]->state == STATE_DISABLED
-        || modules[i]->current_accel_step == 0;
+      bool is_stopped = modules.state[i] == PANIC
+        || modules.state[i] == STATE_DISABLED
+        || modules.current_accel_step[i] == 0;
 
       all_idle &= is_idle;
       all_stopped &= is_stopped;
-      // if (i & 0b11) motor_sensor_io();
     }
     if (all_stopped && !was_stopped) {
       stopped_at_millis = iterationStartMillis;
@@ -267,7 +273,7 @@ inline void run_iteration() {
 #if NEOPIXEL_DEBUGGING_ENABLED
       for (int i = 0; i < NUM_MODULES; i++) {
         uint32_t color = 0;
-        switch (modules[i]->state) {
+        switch (modules.state[i]) {
           case NORMAL:
             color = color_green;
             break;
@@ -291,7 +297,7 @@ inline void run_iteration() {
       if (all_stopped) {
         for (int i = 0; i < NUM_MODULES; i++) {
           uint32_t color;
-          switch (modules[i]->state) {
+          switch (modules.state[i]) {
             case NORMAL:
               statusString[i] = '_';
               break;
@@ -370,8 +376,8 @@ inline void run_iteration() {
               }
 #endif
             for (uint8_t i = 0; i < NUM_MODULES; i++) {
-              modules[i]->ResetErrorCounters();
-              modules[i]->GoHome();
+              modules.ResetErrorCounters(i);
+              modules.GoHome(i);
             }
             break;
           case '#':
@@ -390,10 +396,10 @@ inline void run_iteration() {
               }
 #endif
               for (uint8_t i = 0; i < recv_count; i++) {
-                int8_t index = FindFlapIndex(recv_buffer[i], modules[i]->GetCurrentFlapIndex());
+                int8_t index = FindFlapIndex(recv_buffer[i], modules.GetCurrentFlapIndex(i));
                 if (index != -1) {
-                  if (FORCE_FULL_ROTATION || index != modules[i]->GetTargetFlapIndex()) {
-                    modules[i]->GoToFlapIndex(index);
+                  if (FORCE_FULL_ROTATION || index != modules.GetTargetFlapIndex(i)) {
+                    modules.GoToFlapIndex(i, index);
                   }
                 }
                 Serial.write(recv_buffer[i]);
@@ -423,12 +429,12 @@ void sensor_test_iteration() {
 #if NEOPIXEL_DEBUGGING_ENABLED
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
       uint32_t color;
-      if (!modules[i]->GetHomeState()) {
+      if (!modules.GetHomeState(i)) {
         color = color_green;
       } else {
         color = color_purple;
       }
-      Serial.print(modules[i]->GetHomeState() ? '0' : '1');
+      Serial.print(modules.GetHomeState(i) ? '0' : '1');
 
       // Make LEDs flash in sequence to indicate sensor test mode
       if ((millis() / 32) % NUM_MODULES == i) {
@@ -442,7 +448,7 @@ void sensor_test_iteration() {
 #error NEOPIXEL_DEBUGGING_ENABLED is false, but NUM_MODULES is > 1. To run a sensor test without neopixels, the Arduino will use the builtin LED so NUM_MODULES must be set to 1.
 #endif
     // We only have one LED - just show the first module's home state status
-    digitalWrite(LED_BUILTIN, !modules[0]->GetHomeState() ? HIGH : LOW);
+    digitalWrite(LED_BUILTIN, !modules.GetHomeState(0) ? HIGH : LOW);
 #endif
 delay(100);
 }
@@ -467,7 +473,7 @@ void dump_status() {
   Serial.print(FAVR("{\"type\":\"status\", \"modules\":["));
   for (uint8_t i = 0; i < NUM_MODULES; i++) {
     Serial.print(FAVR("{\"state\":\""));
-    switch (modules[i]->state) {
+    switch (modules.state[i]) {
       case NORMAL:
         Serial.print(FAVR("normal"));
         break;
@@ -485,11 +491,11 @@ void dump_status() {
         break;
     }
     Serial.print(FAVR("\", \"flap\":\""));
-    Serial.write(flaps[modules[i]->GetCurrentFlapIndex()]);
+    Serial.write(flaps[modules.GetCurrentFlapIndex(i)]);
     Serial.print(FAVR("\", \"count_missed_home\":"));
-    Serial.print(modules[i]->count_missed_home);
+    Serial.print(modules.count_missed_home[i]);
     Serial.print(FAVR(", \"count_unexpected_home\":"));
-    Serial.print(modules[i]->count_unexpected_home);
+    Serial.print(modules.count_unexpected_home[i]);
     Serial.print(FAVR("}"));
     if (i < NUM_MODULES - 1) {
       Serial.print(FAVR(", "));
@@ -15,11 +15,104 @@
 // Whether to force a full rotation when the same letter is specified again
 #define FORCE_FULL_ROTATION true
 
+// Whether modules use the jerk-limited S-curve acceleration profile (faster top
+// speed, separate decel ramp) by default rather than the linear ramp. The
+// ramps themselves are set up below.
+#ifndef S_CURVE_ACCELERATION
+#define S_CURVE_ACCELERATION false
+#endif
+
+// Whether to half-step the motors (alternating one and two coils energized)
+// rather than full-step them. Half-stepping is smoother and less prone to
+// resonance, at the cost of slightly lower torque on the one-coil steps.
+#ifndef HALF_STEP
+#define HALF_STEP false
+#endif
+
+// Acceleration ramps, generated at compile time by src/acceleration.h. All
+// periods are per full step (half-stepping halves them). Each can be
+// overridden from the build flags, so that different builds can carry their
+// own tuned profiles; a ramp can be at most a few hundred steps long.
+//
+// Linear ramp: from ACCEL_MAX_PERIOD_MICROS down to ACCEL_MIN_PERIOD_MICROS
+// over ACCEL_TIME_MICROS
+#ifndef ACCEL_MIN_PERIOD_MICROS
+#define ACCEL_MIN_PERIOD_MICROS 1600
+#endif
+#ifndef ACCEL_MAX_PERIOD_MICROS
+#define ACCEL_MAX_PERIOD_MICROS 10000
+#endif
+#ifndef ACCEL_TIME_MICROS
+#define ACCEL_TIME_MICROS 200000
+#endif
+// Period used while a module is stopped (accel step 0)
+#ifndef ACCEL_IDLE_PERIOD_MICROS
+#define ACCEL_IDLE_PERIOD_MICROS 1600
+#endif
+// Jerk-limited ramps: from ACCEL_MAX_PERIOD_MICROS down to
+// S_CURVE_MIN_PERIOD_MICROS, with a longer ramp for slowing down so that the
+// spool settles gently near the home sensor
+#ifndef S_CURVE_MIN_PERIOD_MICROS
+#define S_CURVE_MIN_PERIOD_MICROS 1300
+#endif
+#ifndef S_CURVE_ACCEL_TIME_MICROS
+#define S_CURVE_ACCEL_TIME_MICROS 250000
+#endif
+#ifndef S_CURVE_DECEL_TIME_MICROS
+#define S_CURVE_DECEL_TIME_MICROS 300000
+#endif
+
+// Number of recent step events each module keeps for post-mortem analysis of
+// lost steps and panics (see MotionTraceEvent). 0 disables recording. Must be
+// a power of 2, up to 128; each event takes 4 bytes of RAM per module.
+#ifndef MOTION_TRACE_LENGTH
+#define MOTION_TRACE_LENGTH 0
+#endif
+
+// Whether the ESP32 sends the motor data and reads the sensor data in a single
+// full-duplex SPI transfer (as the AVR does), rather than a send followed by
+// a separate receive. Set to false to go back to the separate send and receive.
+#ifndef SPI_FULL_DUPLEX
+#define SPI_FULL_DUPLEX true
+#endif
+
+// Whether the ESP32 logs how fast its update loop runs (and how long it spends
+// in SPI IO) every few seconds while modules are moving.
+#ifndef LOOP_BENCHMARK
+#define LOOP_BENCHMARK false
+#endif
+
 // Whether to use/expect a home sensor. Enable for auto-calibration via home
 // sensor feedback. Disable for basic open-loop control (useful when first
 // testing the split-flap, since home calibration can be tricky to fine tune)
 #define HOME_CALIBRATION_ENABLED true
 
+// Optional per-module features. Each takes RAM for every module, so idle
+// hold and home offset calibration (which only the ESP32 firmware has any way
+// to use) are left out of the ATmega builds by default. Each can be set from
+// the build flags.
+// - Idle hold: keeping the coils energized after a move (see SetIdleHold())
+#ifndef IDLE_HOLD_ENABLED
+#ifdef __AVR__
+#define IDLE_HOLD_ENABLED false
+#else
+#define IDLE_HOLD_ENABLED true
+#endif
+#endif
+// - Home offset calibration: learning where each module's home sensor sits
+//   (see StartHomeOffsetCalibration())
+#ifndef HOME_OFFSET_CALIBRATION_ENABLED
+#ifdef __AVR__
+#define HOME_OFFSET_CALIBRATION_ENABLED false
+#else
+#define HOME_OFFSET_CALIBRATION_ENABLED true
+#endif
+#endif
+// - Adaptive speed: backing a module's top speed off after home errors
+#ifndef ADAPTIVE_SPEED_ENABLED
+#define ADAPTIVE_SPEED_ENABLED true
+#endif
+
 // 3) Flap Contents & Order
 #define NUM_FLAPS (40)
 
@@ -14,14 +14,156 @@
    limitations under the License.
 */
 
-// NOTE: THIS FILE IS AUTOGENERATED! DO NOT MODIFY!
-// To update, run `arduino/splitflap/Splitflap/src/generate_acceleration.py`
-
 #ifndef ACCELERATION
 #define ACCELERATION
 
+#include "../config.h"
+
+// Acceleration ramp tables, generated at compile time from the ACCEL_* and S_CURVE_* settings in config.h. Each table
+// starts with the idle period (accel step 0), followed by the period of each step of the ramp. Working out a step's
+// period takes one level of constexpr recursion per step before it, so ramps are limited to about 500 steps (GCC's
+// default -fconstexpr-depth is 512).
 namespace Acceleration {
-    const PROGMEM uint16_t ACCEL_STEP_PERIODS[] = {1600, 10000, 7920, 6800, 6064, 5530, 5119, 4790, 4518, 4288, 4090, 3918, 3766, 3631, 3510, 3400, 3300, 3208, 3123, 3045, 2973, 2906, 2843, 2783, 2728, 2676, 2626, 2580, 2535, 2493, 2453, 2415, 2379, 2344, 2310, 2278, 2248, 2218, 2190, 2163, 2137, 2111, 2087, 2063, 2040, 2018, 1997, 1976, 1956, 1937, 1918, 1900, 1882, 1864, 1848, 1831, 1815, 1800, 1784, 1770, 1755, 1741, 1727, 1714, 1701, 1688, 1675, 1663, 1651, 1639, 1628, 1617, 1606};
-    const uint8_t MAX_ACCEL_STEP = 72;
+  enum RampShape : uint8_t {
+    // Velocity increases at a constant rate
+    RAMP_LINEAR,
+    // Constant jerk up to peak acceleration at the midpoint of the ramp, then constant jerk back down to zero
+    // acceleration
+    RAMP_S_CURVE,
+  };
+
+  // A ramp from max_period down to min_period (in microseconds) over ramp_time, with velocity following shape. The
+  // functions below work on these both at compile time and (e.g. for host tools trying out ramps) at run time.
+  struct RampParams {
+    uint16_t min_period;
+    uint16_t max_period;
+    uint32_t ramp_time;
+    RampShape shape;
+  };
+
+  // shape(t / ramp_time), scaled up by RampScale() so that it stays an integer
+  constexpr uint64_t RampScale(RampParams r) {
+    return r.shape == RAMP_LINEAR ? r.ramp_time : (uint64_t)r.ramp_time * r.ramp_time;
+  }
+
+  constexpr uint64_t ScaledShape(RampParams r, uint64_t t) {
+    return r.shape == RAMP_LINEAR ? t
+        : 2 * t < r.ramp_time ? 2 * t * t
+        : RampScale(r) - 2 * (r.ramp_time - t) * (r.ramp_time - t);
+  }
+
+  // Period of the step that starts t microseconds into the ramp: 1 / velocity, rounded down, where velocity goes from
+  // 1 / max_period to 1 / min_period as the shape goes from 0 to 1. Kept in integers so that the tables come out the
+  // same with every compiler (double is only 32 bits on AVR).
+  constexpr uint16_t PeriodAtTime(RampParams r, uint32_t t) {
+    return (uint64_t)r.max_period * r.min_period * RampScale(r)
+        / ((uint64_t)r.min_period * RampScale(r) + (uint64_t)(r.max_period - r.min_period) * ScaledShape(r, t));
+  }
+
+  // Time at which the step starting at time t ends
+  constexpr uint32_t EndOfStep(RampParams r, uint32_t t) {
+    return t + PeriodAtTime(r, t);
+  }
+
+  constexpr uint32_t StartOfStep(RampParams r, uint16_t step) {
+    return step == 0 ? 0 : EndOfStep(r, StartOfStep(r, step - 1));
+  }
+
+  // Number of steps it takes to get through the ramp from time t
+  constexpr uint16_t RampSteps(RampParams r, uint32_t t = 0) {
+    return t < r.ramp_time ? 1 + RampSteps(r, EndOfStep(r, t)) : 0;
+  }
+
+  // Period of each step of the ramp, which then carries on at top speed (so that a shorter ramp can share a table with
+  // a longer one)
+  constexpr uint16_t StepPeriod(RampParams r, uint16_t step) {
+    return step < RampSteps(r) ? PeriodAtTime(r, StartOfStep(r, step)) : r.min_period;
+  }
+
+  // Whether the ramp arithmetic above can't overflow for r
+  constexpr bool IsValidRamp(RampParams r) {
+    return r.min_period > 0 && r.min_period < r.max_period
+        && (uint64_t)r.max_period * r.min_period <= ~(uint64_t)0 / ((uint64_t)r.ramp_time * r.ramp_time);
+  }
+
+  // A ramp fixed at compile time, to generate a table from
+  template <uint16_t MinPeriod, uint16_t MaxPeriod, uint32_t RampTime, RampShape Shape>
+  struct Ramp {
+    static constexpr RampParams Params() {
+      return {MinPeriod, MaxPeriod, RampTime, Shape};
+    }
+
+    static_assert(IsValidRamp(Params()), "Ramp must speed up, and not take so long that the ramp arithmetic overflows");
+  };
+
+  template <uint16_t... Periods>
+  struct Table {
+    static const uint16_t periods[sizeof...(Periods)];
+  };
+
+  template <uint16_t... Periods>
+  const uint16_t Table<Periods...>::periods[sizeof...(Periods)] PROGMEM = {Periods...};
+
+  // Builds Table<IdlePeriod, StepPeriod(0), ..., StepPeriod(Count - 2)>
+  template <typename R, uint16_t IdlePeriod, uint16_t Count, uint16_t... Periods>
+  struct Generate : Generate<R, IdlePeriod, Count - 1, StepPeriod(R::Params(), Count - 2), Periods...> {};
+
+  template <typename R, uint16_t IdlePeriod, uint16_t... Periods>
+  struct Generate<R, IdlePeriod, 1, Periods...> {
+    typedef Table<IdlePeriod, Periods...> Type;
+  };
+
+#if HALF_STEP
+  // Half-steps take half the time of full steps at the same motor speed, so a ramp has twice as many of them
+  const uint16_t MICROSTEPS_PER_STEP = 2;
+#else
+  const uint16_t MICROSTEPS_PER_STEP = 1;
+#endif
+
+  typedef Ramp<ACCEL_MIN_PERIOD_MICROS / MICROSTEPS_PER_STEP, ACCEL_MAX_PERIOD_MICROS / MICROSTEPS_PER_STEP,
+      ACCEL_TIME_MICROS, RAMP_LINEAR> LinearRamp;
+  typedef Ramp<S_CURVE_MIN_PERIOD_MICROS / MICROSTEPS_PER_STEP, ACCEL_MAX_PERIOD_MICROS / MICROSTEPS_PER_STEP,
+      S_CURVE_ACCEL_TIME_MICROS, RAMP_S_CURVE> SCurveAccelRamp;
+  typedef Ramp<S_CURVE_MIN_PERIOD_MICROS / MICROSTEPS_PER_STEP, ACCEL_MAX_PERIOD_MICROS / MICROSTEPS_PER_STEP,
+      S_CURVE_DECEL_TIME_MICROS, RAMP_S_CURVE> SCurveDecelRamp;
+  const uint16_t IDLE_PERIOD = ACCEL_IDLE_PERIOD_MICROS / MICROSTEPS_PER_STEP;
+
+  const uint16_t MAX_ACCEL_STEP = RampSteps(LinearRamp::Params());
+  const uint16_t *const ACCEL_STEP_PERIODS = Generate<LinearRamp, IDLE_PERIOD, MAX_ACCEL_STEP + 1>::Type::periods;
+
+  // Accel and decel ramps are indexed by the same accel step, so they always have the same length
+  const uint16_t S_CURVE_MAX_ACCEL_STEP = RampSteps(SCurveAccelRamp::Params()) > RampSteps(SCurveDecelRamp::Params())
+      ? RampSteps(SCurveAccelRamp::Params()) : RampSteps(SCurveDecelRamp::Params());
+  const uint16_t *const S_CURVE_ACCEL_STEP_PERIODS =
+      Generate<SCurveAccelRamp, IDLE_PERIOD, S_CURVE_MAX_ACCEL_STEP + 1>::Type::periods;
+  const uint16_t *const S_CURVE_DECEL_STEP_PERIODS =
+      Generate<SCurveDecelRamp, IDLE_PERIOD, S_CURVE_MAX_ACCEL_STEP + 1>::Type::periods;
+
+  // Proof that the default settings reproduce the tables that used to be generated offline (in floating point) and
+  // committed: the length and a position-weighted checksum of each ramp, as printed by generate_acceleration.py. Splits
+  // the range in half at each level to stay within the constexpr recursion limit.
+  constexpr uint32_t RampChecksum(RampParams r, uint16_t first, uint16_t count) {
+    return count == 1 ? (uint32_t)(first + 1) * StepPeriod(r, first)
+        : RampChecksum(r, first, count / 2) + RampChecksum(r, first + count / 2, count - count / 2);
+  }
+
+#if ACCEL_MIN_PERIOD_MICROS == 1600 && ACCEL_MAX_PERIOD_MICROS == 10000 && ACCEL_TIME_MICROS == 200000 \
+    && S_CURVE_MIN_PERIOD_MICROS == 1300 && S_CURVE_ACCEL_TIME_MICROS == 250000 && S_CURVE_DECEL_TIME_MICROS == 300000
+#if HALF_STEP
+  static_assert(MAX_ACCEL_STEP == 145 && RampChecksum(LinearRamp::Params(), 0, MAX_ACCEL_STEP) == 11083841,
+      "Linear ramp differs from the original table");
+  static_assert(S_CURVE_MAX_ACCEL_STEP == 260
+      && RampChecksum(SCurveAccelRamp::Params(), 0, S_CURVE_MAX_ACCEL_STEP) == 25189136
+      && RampChecksum(SCurveDecelRamp::Params(), 0, S_CURVE_MAX_ACCEL_STEP) == 26559749,
+      "S-curve ramps differ from the original tables");
+#else
+  static_assert(MAX_ACCEL_STEP == 72 && RampChecksum(LinearRamp::Params(), 0, MAX_ACCEL_STEP) == 5527930,
+      "Linear ramp differs from the original table");
+  static_assert(S_CURVE_MAX_ACCEL_STEP == 130
+      && RampChecksum(SCurveAccelRamp::Params(), 0, S_CURVE_MAX_ACCEL_STEP) == 12660814
+      && RampChecksum(SCurveDecelRamp::Params(), 0, S_CURVE_MAX_ACCEL_STEP) == 13350727,
+      "S-curve ramps differ from the original tables");
+#endif
+#endif
 }
 #endif
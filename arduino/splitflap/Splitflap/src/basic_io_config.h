@@ -33,17 +33,13 @@
   // Sensor B: PC4 = pin A4
   // Sensor C: PC5 = pin A5
 
-  SplitflapModule moduleA((uint8_t&)PORTB, 0, (uint8_t&)PINB, B00010000);
-  SplitflapModule moduleB((uint8_t&)PORTD, 4, (uint8_t&)PINC, B00010000);
-  SplitflapModule moduleC((uint8_t&)PORTC, 0, (uint8_t&)PINC, B00100000);
-
-  SplitflapModule* modules[] = {
-    &moduleA,
-    &moduleB,
-    &moduleC,
-  };
+  SplitflapModuleBank<NUM_MODULES> modules;
 
   void initialize_modules() {
+    modules.Configure(0, (uint8_t&)PORTB, 0, (uint8_t&)PINB, B00010000);
+    modules.Configure(1, (uint8_t&)PORTD, 4, (uint8_t&)PINC, B00010000);
+    modules.Configure(2, (uint8_t&)PORTC, 0, (uint8_t&)PINC, B00100000);
+
     // Initialize motor outputs
     DDRB |= 0xF; // Motor A
     DDRD |= 0xF0; // Motor B
@@ -60,35 +56,26 @@
   }
 #elif defined(__AVR_ATmega2560__)
 
-  SplitflapModule moduleA((uint8_t&)PORTB, 4, (uint8_t&)PINE, 1 << 5); //10-13    3
-  SplitflapModule moduleB((uint8_t&)PORTA, 0, (uint8_t&)PINE, 1 << 4); //25-22    2
-  SplitflapModule moduleC((uint8_t&)PORTA, 4, (uint8_t&)PINJ, 1 << 1); //29-26    14
-  SplitflapModule moduleD((uint8_t&)PORTC, 4, (uint8_t&)PINJ, 1 << 0); //33-30    15
-  SplitflapModule moduleE((uint8_t&)PORTC, 0, (uint8_t&)PINH, 1 << 1); //37-34    16
-  SplitflapModule moduleF((uint8_t&)PORTL, 4, (uint8_t&)PINH, 1 << 0); //45-42    17
-  SplitflapModule moduleG((uint8_t&)PORTL, 0, (uint8_t&)PIND, 1 << 3); //49-46    18
-  SplitflapModule moduleH((uint8_t&)PORTB, 0, (uint8_t&)PIND, 1 << 2); //53-50    19
-  SplitflapModule moduleI((uint8_t&)PORTK, 4, (uint8_t&)PIND, 1 << 7); //A12-A15  38
-  SplitflapModule moduleJ((uint8_t&)PORTK, 0, (uint8_t&)PING, 1 << 2); //A8-A11   39
-  SplitflapModule moduleK((uint8_t&)PORTF, 4, (uint8_t&)PING, 1 << 1); //A4-A7    40
-  SplitflapModule moduleL((uint8_t&)PORTF, 0, (uint8_t&)PING, 1 << 0); //A0-A3    41
-
-  SplitflapModule* modules[] = {
-    &moduleA,
-    &moduleB,
-    &moduleC,
-    &moduleD,
-    &moduleE,
-    &moduleF,
-    &moduleG,
-    &moduleH,
-    &moduleI,
-    &moduleJ,
-    &moduleK,
-    &moduleL,
-  };
+  #if NUM_MODULES > 12
+  #error "Basic IO mode only supports up to 12 modules on Atmega2560-based boards. Set NUM_MODULES to 12 or fewer."
+  #endif
+
+  SplitflapModuleBank<NUM_MODULES> modules;
 
   void initialize_modules() {
+    modules.Configure(0, (uint8_t&)PORTB, 4, (uint8_t&)PINE, 1 << 5); //10-13    3
+    modules.Configure(1, (uint8_t&)PORTA, 0, (uint8_t&)PINE, 1 << 4); //25-22    2
+    modules.Configure(2, (uint8_t&)PORTA, 4, (uint8_t&)PINJ, 1 << 1); //29-26    14
+    modules.Configure(3, (uint8_t&)PORTC, 4, (uint8_t&)PINJ, 1 << 0); //33-30    15
+    modules.Configure(4, (uint8_t&)PORTC, 0, (uint8_t&)PINH, 1 << 1); //37-34    16
+    modules.Configure(5, (uint8_t&)PORTL, 4, (uint8_t&)PINH, 1 << 0); //45-42    17
+    modules.Configure(6, (uint8_t&)PORTL, 0, (uint8_t&)PIND, 1 << 3); //49-46    18
+    modules.Configure(7, (uint8_t&)PORTB, 0, (uint8_t&)PIND, 1 << 2); //53-50    19
+    modules.Configure(8, (uint8_t&)PORTK, 4, (uint8_t&)PIND, 1 << 7); //A12-A15  38
+    modules.Configure(9, (uint8_t&)PORTK, 0, (uint8_t&)PING, 1 << 2); //A8-A11   39
+    modules.Configure(10, (uint8_t&)PORTF, 4, (uint8_t&)PING, 1 << 1); //A4-A7    40
+    modules.Configure(11, (uint8_t&)PORTF, 0, (uint8_t&)PING, 1 << 0); //A0-A3    41
+
     // Initialize motor outputs
     DDRF = 0xFF;
     DDRK = 0xFF;
@@ -13,82 +13,116 @@
 #   See the License for the specific language governing permissions and
 #   limitations under the License.
 
-import os
+# Offline reference for the acceleration ramps. acceleration.h generates the tables at compile time (in integer
+# arithmetic) from the ACCEL_* and S_CURVE_* settings in config.h; this script works them out the way they used to be
+# generated, in floating point, to check and preview them off the device:
+#
+# - With no arguments, it prints the length and position-weighted checksum of each ramp for the default settings, which
+#   are what the static_asserts at the end of acceleration.h compare against. Rerun it and update those if the defaults
+#   in config.h change.
+# - --tables also prints every period, e.g. to look at a ramp before trying its settings as build flags in
+#   platformio.ini.
+# - The settings can be overridden with the options below, named after the config.h settings they stand in for.
+#
+# host/test/motion_tables_test.cpp ports generate_ramp() to check the compiled tables against it on every build.
 
-import subprocess
+import argparse
 
 MIN_PERIOD_MICROS = 1600
 MAX_PERIOD_MICROS = 10000
 ACCEL_TIME_MICROS = 200000
 IDLE_PERIOD_MICROS = 1600
 
-_TEMPLATE = """/*
-   Copyright 2020 Scott Bezek and the splitflap contributors
-
-   Licensed under the Apache License, Version 2.0 (the "License");
-   you may not use this file except in compliance with the License.
-   You may obtain a copy of the License at
-
-       http://www.apache.org/licenses/LICENSE-2.0
+# Jerk-limited (S-curve) profile. Acceleration ramps up and back down smoothly rather than jumping straight to its
+# maximum, which lets the motor reach a higher top speed without losing steps. Deceleration gets its own (longer) ramp
+# so that the spool settles gently near the home sensor.
+S_CURVE_MIN_PERIOD_MICROS = 1300
+S_CURVE_ACCEL_TIME_MICROS = 250000
+S_CURVE_DECEL_TIME_MICROS = 300000
 
-   Unless required by applicable law or agreed to in writing, software
-   distributed under the License is distributed on an "AS IS" BASIS,
-   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-   See the License for the specific language governing permissions and
-   limitations under the License.
-*/
+# All periods above are per full step. Half-step tables use half the period for the same motor speed, which also means
+# twice as many entries to cover the same ramp time.
+HALF_STEPS_PER_STEP = 2
 
-// NOTE: THIS FILE IS AUTOGENERATED! DO NOT MODIFY!
-// To update, run `{script_path}`
+def linear(x):
+    return x
 
-#ifndef ACCELERATION
-#define ACCELERATION
+def s_curve(x):
+    # Constant jerk up to peak acceleration at the midpoint, then constant jerk back down to zero acceleration
+    if x < 0.5:
+        return 2 * x * x
+    return 1 - 2 * (1 - x) * (1 - x)
 
-namespace Acceleration {{
-    const PROGMEM uint16_t ACCEL_STEP_PERIODS[] = {{{periods_array}}};
-    const uint8_t MAX_ACCEL_STEP = {max_accel_step};
-}}
-#endif
-"""
-
-def get_git_root():
-    try:
-        return subprocess.check_output(
-            ['git', 'rev-parse', '--show-toplevel'],
-            cwd=os.path.dirname(os.path.abspath(__file__)),
-        ).decode('utf-8').strip()
-    except Exception:
-        raise RuntimeError("Could not read git directory path. Make sure you have git installed and you're working with a git clone of the repository.")
-
-def run(output_file_path):
-    min_velocity = 1000000 / float(MAX_PERIOD_MICROS)
-    max_velocity = 1000000 / float(MIN_PERIOD_MICROS)
+def generate_ramp(min_period_micros, max_period_micros, ramp_time_micros, shape):
+    """Returns the periods of each step when accelerating from max_period_micros to min_period_micros over
+    ramp_time_micros, with velocity following shape(fraction of ramp time)."""
+    min_velocity = 1000000 / float(max_period_micros)
+    max_velocity = 1000000 / float(min_period_micros)
 
     t = 0
-    ramp_periods = [IDLE_PERIOD_MICROS]
-    while t < ACCEL_TIME_MICROS:
-        velocity = min_velocity + (max_velocity - min_velocity) * float(t) / ACCEL_TIME_MICROS
+    periods = []
+    while t < ramp_time_micros:
+        velocity = min_velocity + (max_velocity - min_velocity) * shape(float(t) / ramp_time_micros)
         if velocity > max_velocity:
             velocity = max_velocity
 
         period = int(1000000 / velocity)
-        
-        ramp_periods.append(period)
-        t += period
-    assert len(ramp_periods) <= 255, 'number of ramp periods would exceed a uint8_t'
 
-    git_root = get_git_root()
-    script_path = os.path.relpath(os.path.abspath(__file__), os.path.abspath(git_root))
-    with open(output_file_path, 'wb') as f:
-        f.write(_TEMPLATE.format(
-            periods_array=', '.join([str(x) for x in ramp_periods]),
-            max_accel_step=len(ramp_periods) - 1,
-            script_path=script_path,
-        ).encode('utf-8'))
+        periods.append(period)
+        t += period
+    return periods
+
+def generate_tables(settings, steps_per_step):
+    """Returns the tables for a motor driven with steps_per_step (micro)steps per full step, as (name, periods) pairs.
+    Each table starts with the idle period (accel step 0), as in acceleration.h."""
+    min_period = settings.accel_min_period // steps_per_step
+    max_period = settings.accel_max_period // steps_per_step
+    idle_period = settings.accel_idle_period // steps_per_step
+    s_curve_min_period = settings.s_curve_min_period // steps_per_step
+
+    ramp_periods = [idle_period] + generate_ramp(min_period, max_period, settings.accel_time, linear)
+
+    s_curve_accel = generate_ramp(s_curve_min_period, max_period, settings.s_curve_accel_time, s_curve)
+    s_curve_decel = generate_ramp(s_curve_min_period, max_period, settings.s_curve_decel_time, s_curve)
+    # Pad the shorter ramp out to the same length by cruising at top speed, which is what the module does once it has
+    # finished ramping anyway.
+    s_curve_length = max(len(s_curve_accel), len(s_curve_decel))
+    s_curve_accel += [s_curve_min_period] * (s_curve_length - len(s_curve_accel))
+    s_curve_decel += [s_curve_min_period] * (s_curve_length - len(s_curve_decel))
+
+    return [
+        ('ACCEL_STEP_PERIODS', ramp_periods),
+        ('S_CURVE_ACCEL_STEP_PERIODS', [idle_period] + s_curve_accel),
+        ('S_CURVE_DECEL_STEP_PERIODS', [idle_period] + s_curve_decel),
+    ]
+
+def ramp_checksum(periods):
+    """Matches RampChecksum() in acceleration.h: each step's period weighted by its accel step, skipping the idle
+    period."""
+    return sum(step * period for step, period in enumerate(periods) if step > 0)
+
+def run(settings):
+    for mode, steps_per_step in (('Full step', 1), ('Half step (HALF_STEP)', HALF_STEPS_PER_STEP)):
+        print('{}:'.format(mode))
+        for name, periods in generate_tables(settings, steps_per_step):
+            assert len(periods) <= 65535, 'number of {} periods would exceed a uint16_t'.format(name)
+            print('  {}: max accel step {}, checksum {}'.format(name, len(periods) - 1, ramp_checksum(periods)))
+            if settings.tables:
+                print('    {' + ', '.join(str(x) for x in periods) + '}')
 
 
 if __name__ == '__main__':
-    output_file_path = os.path.join(os.path.dirname(__file__), 'acceleration.h')
-    run(
-        output_file_path,
-    )
+    parser = argparse.ArgumentParser(description='Works out the acceleration ramps acceleration.h generates, in '
+                                     'floating point, for checking and previewing them.')
+    parser.add_argument('--tables', action='store_true', help='print every period, not just the checksums')
+    parser.add_argument('--accel-min-period', type=int, default=MIN_PERIOD_MICROS, help='ACCEL_MIN_PERIOD_MICROS')
+    parser.add_argument('--accel-max-period', type=int, default=MAX_PERIOD_MICROS, help='ACCEL_MAX_PERIOD_MICROS')
+    parser.add_argument('--accel-time', type=int, default=ACCEL_TIME_MICROS, help='ACCEL_TIME_MICROS')
+    parser.add_argument('--accel-idle-period', type=int, default=IDLE_PERIOD_MICROS, help='ACCEL_IDLE_PERIOD_MICROS')
+    parser.add_argument('--s-curve-min-period', type=int, default=S_CURVE_MIN_PERIOD_MICROS,
+                        help='S_CURVE_MIN_PERIOD_MICROS')
+    parser.add_argument('--s-curve-accel-time', type=int, default=S_CURVE_ACCEL_TIME_MICROS,
+                        help='S_CURVE_ACCEL_TIME_MICROS')
+    parser.add_argument('--s-curve-decel-time', type=int, default=S_CURVE_DECEL_TIME_MICROS,
+                        help='S_CURVE_DECEL_TIME_MICROS')
+    run(parser.parse_args())
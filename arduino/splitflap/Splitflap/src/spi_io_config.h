@@ -57,9 +57,22 @@
 #ifdef ESP32
   #include "driver/spi_master.h"
   #include "driver/spi_slave.h"
+  #include "esp_timer.h"
+  #include "soc/gpio_struct.h"
 
   #define LATCH_PIN (25)
 
+  // The latch is driven from the SPI driver's callbacks, which run in its interrupt handler, so it's set through the
+  // GPIO registers directly rather than with digitalWrite(). This needs LATCH_PIN to be one of GPIOs 0-31.
+  #define LATCH_LOW() {GPIO.out_w1tc = (1 << LATCH_PIN);}
+  #define LATCH_HIGH() {GPIO.out_w1ts = (1 << LATCH_PIN);}
+
+  // How long the latch is held low when it's pulsed. Setting and clearing the pin back to back only gives a few tens of
+  // ns, whereas the 74HC165 SH/LD and 74HC595 RCLK inputs need up to ~100 ns (at the low end of their supply range),
+  // and the latch line running the length of a long daisy chain of boards rounds its edges off well beyond that. 1us
+  // leaves a wide margin for that, and costs ~2us per transfer, against the ~150us a 108 module transfer takes.
+  #define LATCH_PULSE_MICROS 1
+
   // Optional - uncomment if connecting the output enable pin of the 74HC595 shift registers
   // to the ESP32. You can otherwise hard-wire the output enable pins to always be enabled.
   // #define OUTPUT_ENABLE_PIN (27)
@@ -79,12 +92,30 @@
   #define DMA_CHANNEL 1
 
 
+#if SPI_FULL_DUPLEX
+  spi_device_handle_t spi_io;
+
+  spi_transaction_t io_transaction;
+
+  // Whether the motor shift registers have been loaded with real data yet, so can be latched (see load_sensors)
+  bool motor_registers_loaded = false;
+#else
   spi_device_handle_t spi_tx;
   spi_device_handle_t spi_rx;
 
   spi_transaction_t tx_transaction;
   spi_transaction_t rx_transaction;
+#endif
+
+  // Whether the transaction(s) for a transfer have been queued and not yet collected
+  bool spi_transfer_pending = false;
 
+  // When the transfer in flight latched the sensor inputs, set from the SPI callbacks
+  volatile unsigned long sensor_latch_micros = 0;
+
+  // When the inputs now in sensor_buffer were latched. With motor_sensor_io_overlapped() that's during the previous
+  // call, so pass this to SplitflapModuleBank::Update() to place home edges correctly.
+  unsigned long sensor_sample_micros = 0;
 
 #endif
 
@@ -104,28 +135,59 @@
 BUFFER_ATTRS uint8_t motor_buffer[MOTOR_BUFFER_LENGTH];
 BUFFER_ATTRS uint8_t sensor_buffer[SENSOR_BUFFER_LENGTH];
 
-#ifdef __AVR__
-// Define placement new so we can initialize SplitflapModules at runtime into a static buffer.
-// (see https://arduino.stackexchange.com/a/1499)
-void* operator new(__attribute__((unused)) size_t size, void* ptr) {
-  return ptr;
-}
+#ifdef ESP32
+static_assert(LATCH_PIN < 32, "LATCH_PIN is set through GPIO.out_w1ts/out_w1tc, which only cover GPIOs 0-31");
+#endif
+
+#if defined(ESP32) && SPI_FULL_DUPLEX
+static_assert(MOTOR_BUFFER_LENGTH >= SENSOR_BUFFER_LENGTH, "Full-duplex transfers read the sensors during the motor data");
+#endif
+
+#ifdef ESP32
+// The buffers the SPI DMA actually transfers. Modules only touch motor_buffer and sensor_buffer, which are copied to and
+// from these at the start and end of a transfer, so they can be updated while a transfer is in flight.
+BUFFER_ATTRS uint8_t motor_dma_buffer[MOTOR_BUFFER_LENGTH];
+BUFFER_ATTRS uint8_t sensor_dma_buffer[SENSOR_BUFFER_LENGTH];
 #endif
 
 #ifdef ESP32
-void reset_latch(spi_transaction_t *trans) {
-    digitalWrite(LATCH_PIN, LOW);
+#if SPI_FULL_DUPLEX
+// The 74HC165 sensor registers load their inputs while the latch is low, and shift them out once it goes high. That
+// same rising edge latches the 74HC595 motor registers, so the latch is pulsed both before and after each transfer and
+// otherwise left high.
+
+// Loads the current sensor inputs before a transfer. This also latches the motor registers again, but they still hold
+// the data they were last latched with, so the motor outputs don't change. The registers power up with garbage in them
+// though, so the first transfer skips this (and reads whatever the sensor registers were left with).
+void IRAM_ATTR load_sensors(spi_transaction_t *trans) {
+    if (motor_registers_loaded) {
+      LATCH_LOW();
+      delayMicroseconds(LATCH_PULSE_MICROS);
+      LATCH_HIGH();
+    }
+    sensor_latch_micros = esp_timer_get_time();
 }
 
-void latch_registers(spi_transaction_t *trans) {
-    digitalWrite(LATCH_PIN, HIGH);
+// Latches the motor data just shifted out
+void IRAM_ATTR latch_motors(spi_transaction_t *trans) {
+    LATCH_LOW();
+    delayMicroseconds(LATCH_PULSE_MICROS);
+    LATCH_HIGH();
+    motor_registers_loaded = true;
+}
+#else
+void IRAM_ATTR reset_latch(spi_transaction_t *trans) {
+    LATCH_LOW();
 }
-#endif
 
-// Static buffer for SplitflapModules (initialized at runtime)
-static char moduleBuffer[NUM_MODULES][sizeof(SplitflapModule)];
+void IRAM_ATTR latch_registers(spi_transaction_t *trans) {
+    LATCH_HIGH();
+    sensor_latch_micros = esp_timer_get_time();
+}
+#endif
+#endif
 
-SplitflapModule* modules[NUM_MODULES];
+SplitflapModuleBank<NUM_MODULES> modules;
 
 #ifdef CHAINLINK
 static const uint8_t MOTOR_OFFSET[] = {0, 0, 1, 2, 3, 3};
@@ -133,11 +195,10 @@ static const uint8_t MOTOR_OFFSET[] = {0, 0, 1, 2, 3, 3};
 
 inline void initialize_modules() {
   for (uint8_t i = 0; i < NUM_MODULES; i++) {
-    // Create SplitflapModules in a statically allocated buffer using placement new
 #ifdef CHAINLINK
-    modules[i] = new (moduleBuffer[i]) SplitflapModule(motor_buffer[MOTOR_BUFFER_LENGTH - 1 - i/6*4 - MOTOR_OFFSET[i%6]], i % 2 == 0 ? 0 : 4, sensor_buffer[i/6], 1 << (i % 6));
+    modules.Configure(i, motor_buffer[MOTOR_BUFFER_LENGTH - 1 - i/6*4 - MOTOR_OFFSET[i%6]], i % 2 == 0 ? 0 : 4, sensor_buffer[i/6], 1 << (i % 6));
 #else
-    modules[i] = new (moduleBuffer[i]) SplitflapModule(motor_buffer[MOTOR_BUFFER_LENGTH - 1 - i/2], i % 2 == 0 ? 0 : 4, sensor_buffer[i/4], 1 << (i % 4));
+    modules.Configure(i, motor_buffer[MOTOR_BUFFER_LENGTH - 1 - i/2], i % 2 == 0 ? 0 : 4, sensor_buffer[i/4], 1 << (i % 4));
 #endif
   }
   
@@ -176,6 +237,36 @@ inline void initialize_modules() {
   ret=spi_bus_initialize(SPI_HOST, &tx_bus_config, DMA_CHANNEL);
   ESP_ERROR_CHECK(ret);
 
+#if SPI_FULL_DUPLEX
+  // Motor data goes out on the same clock edges the sensor data comes back on: like the AVR path, the master samples
+  // MISO on the rising edge that shifts the 74HC165s on to their next bit, and gets the bit from before the edge
+  spi_device_interface_config_t io_device_config = {
+      .command_bits=0,
+      .address_bits=0,
+      .dummy_bits=0,
+      .mode=3,
+      .duty_cycle_pos=0,
+      .cs_ena_pretrans=0,
+      .cs_ena_posttrans=0,
+      .clock_speed_hz=SPI_CLOCK,
+      .input_delay_ns=0,
+      .spics_io_num=-1,
+      .flags = 0,
+      .queue_size=1,
+      .pre_cb=&load_sensors,
+      .post_cb=&latch_motors,
+  };
+  ret=spi_bus_add_device(SPI_HOST, &io_device_config, &spi_io);
+  ESP_ERROR_CHECK(ret);
+
+  // The sensor data comes back on the first SENSOR_BUFFER_LENGTH bytes of the transfer (the motor data is always at
+  // least as long)
+  memset(&io_transaction, 0, sizeof(io_transaction));
+  io_transaction.length = MOTOR_BUFFER_LENGTH*8;
+  io_transaction.rxlength = SENSOR_BUFFER_LENGTH*8;
+  io_transaction.tx_buffer = &motor_dma_buffer;
+  io_transaction.rx_buffer = &sensor_dma_buffer;
+#else
   spi_device_interface_config_t tx_device_config = {
       .command_bits=0,
       .address_bits=0,
@@ -216,14 +307,15 @@ inline void initialize_modules() {
 
   memset(&tx_transaction, 0, sizeof(tx_transaction));
   tx_transaction.length = MOTOR_BUFFER_LENGTH*8;
-  tx_transaction.tx_buffer = &motor_buffer;
+  tx_transaction.tx_buffer = &motor_dma_buffer;
   tx_transaction.rx_buffer = NULL;
 
   memset(&rx_transaction, 0, sizeof(rx_transaction));
   rx_transaction.length = SENSOR_BUFFER_LENGTH*8;
   rx_transaction.rxlength = SENSOR_BUFFER_LENGTH*8;
   rx_transaction.tx_buffer = NULL;
-  rx_transaction.rx_buffer = &sensor_buffer;
+  rx_transaction.rx_buffer = &sensor_dma_buffer;
+#endif
 
 #else
   SPI.begin();
@@ -231,17 +323,55 @@ inline void initialize_modules() {
 #endif
 }
 
-inline void motor_sensor_io() {
 #ifdef ESP32
+// Queues a transfer of the current motor_buffer, which the SPI driver runs in the background (with separate
+// transactions, the tx device was added to the bus first, so it goes before the rx).
+inline void start_motor_sensor_io() {
     esp_err_t ret;
-    
+    memcpy(motor_dma_buffer, motor_buffer, MOTOR_BUFFER_LENGTH);
+
+#if SPI_FULL_DUPLEX
+    ret=spi_device_queue_trans(spi_io, &io_transaction, portMAX_DELAY);
+    assert(ret==ESP_OK);
+#else
     // Send data
-    ret=spi_device_polling_transmit(spi_tx, &tx_transaction);
+    ret=spi_device_queue_trans(spi_tx, &tx_transaction, portMAX_DELAY);
     assert(ret==ESP_OK);
 
     // Receive data
-    ret=spi_device_polling_transmit(spi_rx, &rx_transaction);
+    ret=spi_device_queue_trans(spi_rx, &rx_transaction, portMAX_DELAY);
+    assert(ret==ESP_OK);
+#endif
+    spi_transfer_pending = true;
+}
+
+// Waits for the queued transfer (if any) to finish and copies the sensor data it read into sensor_buffer
+inline void finish_motor_sensor_io() {
+    if (!spi_transfer_pending) {
+      return;
+    }
+    esp_err_t ret;
+    spi_transaction_t* done;
+#if SPI_FULL_DUPLEX
+    ret=spi_device_get_trans_result(spi_io, &done, portMAX_DELAY);
     assert(ret==ESP_OK);
+#else
+    ret=spi_device_get_trans_result(spi_tx, &done, portMAX_DELAY);
+    assert(ret==ESP_OK);
+    ret=spi_device_get_trans_result(spi_rx, &done, portMAX_DELAY);
+    assert(ret==ESP_OK);
+#endif
+    memcpy(sensor_buffer, sensor_dma_buffer, SENSOR_BUFFER_LENGTH);
+    sensor_sample_micros = sensor_latch_micros;
+    spi_transfer_pending = false;
+}
+#endif
+
+inline void motor_sensor_io() {
+#ifdef ESP32
+    finish_motor_sensor_io();
+    start_motor_sensor_io();
+    finish_motor_sensor_io();
 #else
   IN_LATCH();
   delayMicroseconds(1);
@@ -270,6 +400,22 @@ inline void motor_sensor_io() {
 #endif
 }
 
+/**
+ * Like motor_sensor_io(), but on ESP32 returns as soon as the transfer has started rather than waiting for it, so the
+ * caller's next iteration of module updates overlaps the transfer. The sensor_buffer this updates is from the previous
+ * call's transfer, so sensor readings (and chainlink loopbacks) take one more call to show up than with
+ * motor_sensor_io(). sensor_sample_micros records when they were latched, so modules can allow for the delay. Other
+ * boards just call motor_sensor_io().
+ */
+inline void motor_sensor_io_overlapped() {
+#ifdef ESP32
+    finish_motor_sensor_io();
+    start_motor_sensor_io();
+#else
+    motor_sensor_io();
+#endif
+}
+
 #ifdef CHAINLINK
 void chainlink_set_led(uint8_t moduleIndex, bool on) {
   uint8_t groupPosition = moduleIndex % 6;
@@ -318,7 +464,7 @@ void chainlink_set_loopback(uint8_t loop_out_index) {
 /**
  * Validate that the loopback from loop_out_index can be read successfully. There must be AT LEAST 2 motor_sensor_io() invocations
  * between setting the loopback and validating it - one for turning on the shift register output and another to read in the shift
- * register input.
+ * register input. With motor_sensor_io_overlapped() it takes 3, as the input read by the second isn't collected until the third.
  */
 bool chainlink_validate_loopback(uint8_t loop_out_index, bool results[NUM_LOOPBACKS]) {
     bool success = true;
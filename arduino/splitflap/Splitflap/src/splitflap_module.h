@@ -28,113 +28,428 @@
 #define VERBOSE_LOGGING false
 #define ASSERTIONS_ENABLED false
 
-#define FAKE_HOME_SENSOR false
-
+// When half-stepping, all motion is counted in half-steps, so everything below that's measured in steps doubles
+#if HALF_STEP
+#define STEPS_PER_MOTOR_REVOLUTION (64)
+#else
 #define STEPS_PER_MOTOR_REVOLUTION (32)
+#endif
+
+// Each module learns its own top speed from home sensor errors: a missed or unexpected home backs its max accel step
+// off by 1/ADAPTIVE_SPEED_BACKOFF_DIVISOR of the profile's ramp, and every ADAPTIVE_SPEED_CLEAN_REVOLUTIONS consecutive
+// revolutions without errors creeps it back up by one accel step. A module never backs off below
+// 1/ADAPTIVE_SPEED_MIN_DIVISOR of the profile's ramp.
+#define ADAPTIVE_SPEED_BACKOFF_DIVISOR 16
+#define ADAPTIVE_SPEED_CLEAN_REVOLUTIONS 10
+#define ADAPTIVE_SPEED_MIN_DIVISOR 4
+
+// Number of home sensor passes averaged by StartHomeOffsetCalibration()
+#define HOME_OFFSET_CALIBRATION_REVOLUTIONS 8
+
+// A pulsed hold (see SetIdleHold()) energizes a module's coils for part of every IDLE_HOLD_PULSE_PERIOD_MICROS. This is
+// slow enough that a bank of holding modules costs little Update() time, and fast enough that the gearbox's friction
+// keeps the spool in place between pulses.
+#define IDLE_HOLD_PULSE_PERIOD_MICROS 50000
+// Value of SetIdleHold()'s hold_millis that keeps pulsing until the module next moves
+#define IDLE_HOLD_FOREVER 0xFFFF
+
+// Describes one type of splitflap module. SplitflapModuleBank is a template over a traits type with these members, and
+// everything else about the module's geometry is derived from them at compile time (see ModuleGeometry). That way one
+// build can drive different types of module in separate banks (e.g. 40-flap and 52-flap modules in one chain), and each
+// bank is compiled without checks for features its modules don't use.
+//
+// DefaultModuleTraits describes the module configured in config.h.
+struct DefaultModuleTraits {
+  static constexpr uint8_t FLAP_COUNT = NUM_FLAPS;
+
+  // The gear ratio constants represent the input:output ratio of the gearbox expressed as a simplified fraction.
+  // For example, for a gear train with ratios 31:10, 26:9, 22:11, 32:9, the overall ratio expressed as integers would
+  // be (31*26*22*32):(10*9*11*9) == 567424:8910 == 25792:405 ~= 63.684:1. To avoid floating point math, we would use
+  // the simplified integer fraction values 25792 and 405.
+  static constexpr uint32_t GEAR_RATIO_INPUT = 128;
+  static constexpr uint32_t GEAR_RATIO_OUTPUT = 2;
+
+  static constexpr bool HOME_CALIBRATION = HOME_CALIBRATION_ENABLED;
+
+  // Optional features, each of which takes RAM for every module (see config.h). Home offset calibration and adaptive
+  // speed only do anything with HOME_CALIBRATION.
+  static constexpr bool IDLE_HOLD = IDLE_HOLD_ENABLED;
+  static constexpr bool HOME_OFFSET_CALIBRATION = HOME_CALIBRATION_ENABLED && HOME_OFFSET_CALIBRATION_ENABLED;
+  static constexpr bool ADAPTIVE_SPEED = HOME_CALIBRATION_ENABLED && ADAPTIVE_SPEED_ENABLED;
+
+  // Treat every expected home position as found, for testing without home sensors
+  static constexpr bool FAKE_HOME_SENSOR = false;
+
+  // How long the home sensor must keep reading high or low before a change is believed, so that electrical noise (e.g.
+  // from the motor drivers) isn't mistaken for the home position. Measured between the times the samples were latched,
+  // so it's the same however often Update() happens to run (every I/O cycle on the AVR, but only as often as a module
+  // is due to step on the ESP32). It should stay well short of the time the sensor is high at top speed.
+  static constexpr uint16_t HOME_SENSOR_DEBOUNCE_MICROS = 250;
+
+  // The home sensor may be up to 1/HOME_ERROR_MARGIN_DIVISOR of a flap either side of where it's expected. This covers
+  // mechanical variation in the spool and sensor, which hasn't been measured across enough hardware to narrow it, so it
+  // stays at the original 1/4 flap. Modules with well-behaved sensors can narrow it to catch lost steps sooner.
+  static constexpr uint8_t HOME_ERROR_MARGIN_DIVISOR = 4;
+};
 
-// The gear ratio constants below represent the input:output ratio of the gearbox expressed as a simplified fraction.
-// For example, for a gear train with ratios 31:10, 26:9, 22:11, 32:9, the overall ratio expressed as integers would be
-// (31*26*22*32):(10*9*11*9) == 567424:8910 == 25792:405 ~= 63.684:1. To avoid floating point math, we would use the
-// simplified integer fraction values 25792 and 405.
-#define _GEAR_RATIO_INPUT (128)
-#define _GEAR_RATIO_OUTPUT (2)
+template <typename Traits>
+struct ModuleGeometry {
+  // All motion is tracked in terms of motor steps (rather than motor revolutions), so we pre-multiply the gear ratio
+  // input by the number of motor steps per revolution as a more useful quantity to work with.
+  static constexpr uint32_t GEAR_RATIO_INPUT_STEPS = STEPS_PER_MOTOR_REVOLUTION * Traits::GEAR_RATIO_INPUT;
 
-// All motion is tracked in terms of motor steps (rather than motor revolutions), so we pre-multiply the gear ratio input
-// by the number of motor steps per revolution as a more useful quantity to work with.
-#define GEAR_RATIO_INPUT_STEPS (STEPS_PER_MOTOR_REVOLUTION * _GEAR_RATIO_INPUT)
+  // Likewise, we care about the number of flaps flipped, rather than the number of output shaft revolutions, so we
+  // pre-multiply the gear ratio output by the number of flaps per revolution as a more useful quantity to work with.
+  static constexpr uint32_t GEAR_RATIO_OUTPUT_FLAPS = Traits::GEAR_RATIO_OUTPUT * Traits::FLAP_COUNT;
 
-// Likewise, we care about the number of flaps flipped, rather than the number of output shaft revolutions, so we
-// pre-multiply the gear ratio output by the number of flaps per revolution as a more useful quantity to work with.
-#define GEAR_RATIO_OUTPUT_FLAPS (_GEAR_RATIO_OUTPUT * NUM_FLAPS)
+  // This is "rough" because it's integer division; it shouldn't be used for movement calculations or the error would
+  // accumulate.
+  static constexpr uint32_t ROUGH_STEPS_PER_FLAP = GEAR_RATIO_INPUT_STEPS / GEAR_RATIO_OUTPUT_FLAPS;
 
-// This is "rough" because it's integer division; it shouldn't be used for movement calculations or the error would
-// accumulate.
-#define _ROUGH_STEPS_PER_FLAP (GEAR_RATIO_INPUT_STEPS / GEAR_RATIO_OUTPUT_FLAPS)
+  // The number of steps in either direction that's acceptable error for the home sensor
+  static constexpr uint32_t HOME_ERROR_MARGIN_STEPS = ROUGH_STEPS_PER_FLAP / Traits::HOME_ERROR_MARGIN_DIVISOR;
 
-#if HOME_CALIBRATION_ENABLED
-// The number of steps in either direction that's acceptable error for the home sensor
-#define HOME_ERROR_MARGIN_STEPS (_ROUGH_STEPS_PER_FLAP / 4)
+  // After finding the home position, how long to wait before considering another home blip to be an unexpected error
+  static constexpr uint32_t UNEXPECTED_HOME_START_BUFFER_STEPS = ROUGH_STEPS_PER_FLAP * 5;
+
+  // When recalibrating the home position, the number of steps to travel searching for home before giving up
+  static constexpr uint32_t MAX_STEPS_LOOKING_FOR_HOME = (Traits::FLAP_COUNT + 2) * ROUGH_STEPS_PER_FLAP;
+
+  // Home searches that know roughly where home is slow down to homing speed this many steps before it, and give up
+  // this many steps after it
+  static constexpr uint32_t HOME_APPROACH_STEPS = ROUGH_STEPS_PER_FLAP;
+
+  // Number of flap boundaries in FlapSteps tables: every output revolution in one cycle of the gearbox, plus one more
+  // revolution so that a move starting anywhere in the cycle can look up where it ends
+  static constexpr uint16_t FLAP_BOUNDARY_COUNT = GEAR_RATIO_OUTPUT_FLAPS + Traits::FLAP_COUNT + 1;
+
+  static_assert(Traits::GEAR_RATIO_OUTPUT <= 2, "Flap index math assumes at most 2 output revolutions per gearbox cycle");
+  static_assert(Traits::HOME_SENSOR_DEBOUNCE_MICROS > 0 && Traits::HOME_SENSOR_DEBOUNCE_MICROS < 0x8000,
+      "Home sensor debounce must take at least two samples, and fit the 16 bit sample times");
+  static_assert(HOME_ERROR_MARGIN_STEPS > 0, "Home error margin must be at least one step");
+};
 
-// After finding the home position, how long to wait before considering another home blip to be an unexpected error
-#define UNEXPECTED_HOME_START_BUFFER_STEPS (_ROUGH_STEPS_PER_FLAP * 5)
+namespace Acceleration {
+  // Linear ramp, mirrored for deceleration
+  const Profile LINEAR = {ACCEL_STEP_PERIODS, ACCEL_STEP_PERIODS, MAX_ACCEL_STEP};
 
-// When recalibrating the home position, the number of steps to travel searching for home before giving up
-#define MAX_STEPS_LOOKING_FOR_HOME ((NUM_FLAPS + 2) * _ROUGH_STEPS_PER_FLAP)
+  // Jerk-limited ramps with a higher top speed
+  const Profile S_CURVE = {S_CURVE_ACCEL_STEP_PERIODS, S_CURVE_DECEL_STEP_PERIODS, S_CURVE_MAX_ACCEL_STEP};
+
+#if S_CURVE_ACCELERATION
+  const Profile *const DEFAULT_PROFILE = &S_CURVE;
+#else
+  const Profile *const DEFAULT_PROFILE = &LINEAR;
 #endif
+}
+
+// Step positions where each flap begins, so that converting between steps and flaps is a table lookup rather than 32-bit
+// multiplies and divides (which are slow on AVR). Each module geometry gets its own table, of
+// Geometry::FLAP_BOUNDARY_COUNT entries.
+namespace FlapSteps {
+  // The first step whose flap floor (step * GEAR_RATIO_OUTPUT_FLAPS / GEAR_RATIO_INPUT_STEPS) is the given flap,
+  // i.e. the flap's position rounded UP to a whole step
+  template <typename Geometry>
+  constexpr uint32_t FirstStep(uint32_t flap) {
+    return (flap * Geometry::GEAR_RATIO_INPUT_STEPS + Geometry::GEAR_RATIO_OUTPUT_FLAPS - 1) / Geometry::GEAR_RATIO_OUTPUT_FLAPS;
+  }
+
+  template <uint16_t... Steps>
+  struct Table {
+    static const uint16_t first_step[sizeof...(Steps)];
+  };
+
+  template <uint16_t... Steps>
+  const uint16_t Table<Steps...>::first_step[sizeof...(Steps)] PROGMEM = {Steps...};
+
+  // Builds Table<FirstStep(0), ..., FirstStep(Count - 1)> (C++11 has no std::make_index_sequence, and AVR has no STL)
+  template <typename Geometry, uint16_t Count, uint16_t... Steps>
+  struct Generate : Generate<Geometry, Count - 1, FirstStep<Geometry>(Count - 1), Steps...> {};
+
+  template <typename Geometry, uint16_t... Steps>
+  struct Generate<Geometry, 0, Steps...> {
+    typedef Table<Steps...> Type;
+  };
+
+  // Proof that the table reproduces the original arithmetic. Since the flap floor never decreases as the step
+  // increases, checking it on both sides of every flap boundary covers every step.
+  template <typename Geometry>
+  constexpr uint32_t DividedFlapFloor(uint32_t step) {
+    return step * Geometry::GEAR_RATIO_OUTPUT_FLAPS / Geometry::GEAR_RATIO_INPUT_STEPS;
+  }
+
+  template <typename Geometry>
+  constexpr uint32_t DividedTargetStep(uint32_t flap) {
+    return flap * Geometry::GEAR_RATIO_INPUT_STEPS / Geometry::GEAR_RATIO_OUTPUT_FLAPS
+        + (flap * Geometry::GEAR_RATIO_INPUT_STEPS % Geometry::GEAR_RATIO_OUTPUT_FLAPS != 0 ? 1 : 0);
+  }
+
+  template <typename Geometry>
+  constexpr bool MatchesDivision(uint32_t flap) {
+    return FirstStep<Geometry>(flap) == DividedTargetStep<Geometry>(flap)
+        && DividedFlapFloor<Geometry>(FirstStep<Geometry>(flap)) == flap
+        && (flap == 0 || DividedFlapFloor<Geometry>(FirstStep<Geometry>(flap) - 1) == flap - 1);
+  }
+
+  // Splits the range in half at each level to stay well within the constexpr recursion limit
+  template <typename Geometry>
+  constexpr bool AllMatchDivision(uint32_t first, uint32_t last) {
+    return first == last
+        ? MatchesDivision<Geometry>(first)
+        : AllMatchDivision<Geometry>(first, (first + last) / 2) && AllMatchDivision<Geometry>((first + last) / 2 + 1, last);
+  }
+}
+
+// Per-module state for a feature that a bank's Traits can turn off: N values when Enabled, and otherwise a single
+// placeholder that reads as T() however it was last written, so a bank without the feature doesn't spend RAM on it
+// and code that touches it still compiles (and folds away behind the Traits check that guards it).
+template <bool Enabled, typename T, uint8_t N>
+struct OptionalArray {
+  T values[N];
+
+  T &operator[](uint8_t i) {
+    return values[i];
+  }
+};
+
+template <typename T, uint8_t N>
+struct OptionalArray<false, T, N> {
+  T placeholder;
 
-class SplitflapModule {
+  T &operator[](uint8_t) {
+    placeholder = T();
+    return placeholder;
+  }
+};
+
+// Drives a fixed number of splitflap modules. Module state is stored as parallel arrays (one entry per module) rather
+// than as one object per module, so that Update() can step every module in a single tight pass over contiguous memory.
+//
+// Only modules that are moving (or about to move) need stepping, so they're tracked in a min-heap ordered by the time
+// of their next step. Update() only touches the modules at the top of the heap that are due, and
+// GetNextStepMicros() tells the caller how long it can sleep before anything else needs to happen.
+template <uint8_t N, typename Traits = DefaultModuleTraits>
+class SplitflapModuleBank {
  private:
+  typedef ModuleGeometry<Traits> Geometry;
+  typedef typename FlapSteps::Generate<Geometry, Geometry::FLAP_BOUNDARY_COUNT>::Type FirstSteps;
+
+  static_assert(Geometry::FLAP_BOUNDARY_COUNT <= 256, "Too many flaps to index flap boundaries with uint8_t");
+  static_assert(FlapSteps::FirstStep<Geometry>(Geometry::FLAP_BOUNDARY_COUNT - 1) <= 0xFFFF,
+      "Flap boundaries don't fit in uint16_t");
+  static_assert(Geometry::GEAR_RATIO_INPUT_STEPS + Geometry::MAX_STEPS_LOOKING_FOR_HOME <= 0xFFFF,
+      "Step positions and the steps left to move don't fit in uint16_t");
+  static_assert(FlapSteps::FirstStep<Geometry>(Geometry::GEAR_RATIO_OUTPUT_FLAPS) == Geometry::GEAR_RATIO_INPUT_STEPS,
+      "Gearbox cycle must end on a flap boundary");
+  static_assert(FlapSteps::AllMatchDivision<Geometry>(0, Geometry::FLAP_BOUNDARY_COUNT - 1),
+      "Flap boundary table doesn't match the division it replaces");
+
   // Configuration:
-  uint8_t &motor_out;
-  const uint8_t motor_bitshift;
+  uint8_t *motor_out[N];
+  uint8_t motor_bitshift[N];
 
-  uint8_t &sensor_in;
-  const uint8_t sensor_bitmask;
+  uint8_t *sensor_in[N];
+  uint8_t sensor_bitmask[N];
 
   // State:
-  bool last_home = false;
-  unsigned long last_update_micros = 0;
+  // Debounced home sensor reading, whether the latest samples have disagreed with it, and when (the low 16 bits of
+  // the sample time) the first of them was latched
+  OptionalArray<Traits::HOME_CALIBRATION, bool, N> last_home;
+  OptionalArray<Traits::HOME_CALIBRATION, bool, N> home_change_pending;
+  OptionalArray<Traits::HOME_CALIBRATION, uint16_t, N> home_change_micros;
+
+  // Most recent rising edge of the home sensor, as the step the module was on when it was first sampled high plus the
+  // fraction (in 256ths) of the way to the next step, and whether UpdateModule() has yet to act on it
+  OptionalArray<Traits::HOME_CALIBRATION, uint16_t, N> home_edge_step;
+  OptionalArray<Traits::HOME_CALIBRATION, uint8_t, N> home_edge_fraction;
+  OptionalArray<Traits::HOME_CALIBRATION, bool, N> home_edge_pending;
+
+  // How the module is searching for home while in the LOOK_FOR_HOME state, and how many more steps it can take at full
+  // speed before it has to be down to homing speed. delta_steps counts down the steps left to search.
+  OptionalArray<Traits::HOME_CALIBRATION, HomeSearch, N> home_search;
+  OptionalArray<Traits::HOME_CALIBRATION, uint16_t, N> home_search_fast_steps;
+
+  // Whether the module's position comes from a coarse home search (i.e. a home edge seen at full speed), so it still
+  // needs to slow down to homing speed the next time it passes home, to pin the edge down
+  OptionalArray<Traits::HOME_CALIBRATION, bool, N> home_approach_pending;
 
   // Tracks the most recent target flap index. Not used during motion, but needed to recalculate target step if we
   // re-calibrate the home position
-  uint8_t target_flap_index = 0;
+  uint8_t target_flap_index[N];
 
-  // Current position/destination. Numbers are modulo GEAR_RATIO_INPUT_STEPS
-  uint32_t current_step = 0;
-  uint32_t delta_steps = 0;
+  // Current position/destination. Numbers are modulo GEAR_RATIO_INPUT_STEPS. Steps are stored in 16 bits (as in the
+  // flap boundary table) to save RAM on AVR, and widened to 32 bits for any arithmetic that can go past the wrap.
+  uint16_t current_step[N];
+  uint16_t delta_steps[N];
 
-#if HOME_CALIBRATION_ENABLED
-  // Home calibration state. All values recalculated whenever we see a home sensor blip
-  HomeState home_state = IGNORE;
-  uint32_t unexpected_home_start_step = 0;  // Start of range where a home sensor blip is unexpected
-  uint32_t unexpected_home_end_step = 0;  // End of range where a home sensor blip is unexpected
+  // Flap floor of current_step (0 to GEAR_RATIO_OUTPUT_FLAPS - 1), advanced as current_step crosses each flap boundary
+  // so that it never needs to be recalculated from current_step
+  uint8_t current_flap[N];
+
+  // Home calibration state (unused unless Traits::HOME_CALIBRATION). All values recalculated whenever we see a home
+  // sensor blip
+  OptionalArray<Traits::HOME_CALIBRATION, HomeState, N> home_state;
+  // Start and end of range where a home sensor blip is unexpected
+  OptionalArray<Traits::HOME_CALIBRATION, uint16_t, N> unexpected_home_start_step;
+  OptionalArray<Traits::HOME_CALIBRATION, uint16_t, N> unexpected_home_end_step;
 
   // Expected home position step plus some margin of error. If we get to this step without having seen a home
   // sensor blip, something is wrong and we need to recalibrate.
-  uint32_t missed_home_step = 0;
-#endif
+  OptionalArray<Traits::HOME_CALIBRATION, uint16_t, N> missed_home_step;
+
+  // Where the next home sensor edge is expected, including the module's home offset
+  OptionalArray<Traits::HOME_CALIBRATION, uint16_t, N> expected_home_step;
+
+  // Home offset calibration: passes of the home sensor still to measure (0 if not calibrating), and the sum of the
+  // edge positions measured so far relative to expected_home_step, in 256ths of a step
+  OptionalArray<Traits::HOME_OFFSET_CALIBRATION, uint8_t, N> home_offset_samples_left;
+  OptionalArray<Traits::HOME_OFFSET_CALIBRATION, int32_t, N> home_offset_error_sum;
+
+  // Whether the module's position came from RestorePosition() rather than from finding home, and is yet to be confirmed
+  // by the home sensor
+  OptionalArray<Traits::HOME_CALIBRATION, bool, N> position_unverified;
 
   // Motor state
-  uint8_t current_phase = 0;
-  uint16_t current_period = Acceleration::ACCEL_STEP_PERIODS[0];
+  uint8_t current_phase[N];
+  uint16_t current_period[N];
+  const Acceleration::Profile *acceleration_profile[N];
+
+  // Multiplier applied to every step period, as a fixed point value where PERIOD_SCALE_ONE is 1x
+  uint16_t period_scale[N];
+
+  // Consecutive revolutions without a home sensor error, for adaptive speed
+  OptionalArray<Traits::ADAPTIVE_SPEED, uint8_t, N> clean_revolutions;
+
+  // Idle hold policy (see SetIdleHold()): full current settle time, the on and off times of each pulse of the pulsed
+  // hold that follows, and how many pulses it lasts (or IDLE_HOLD_FOREVER)
+  OptionalArray<Traits::IDLE_HOLD, uint16_t, N> settle_millis;
+  OptionalArray<Traits::IDLE_HOLD, uint16_t, N> hold_on_micros;
+  OptionalArray<Traits::IDLE_HOLD, uint16_t, N> hold_off_micros;
+  OptionalArray<Traits::IDLE_HOLD, uint16_t, N> hold_pulses;
+
+  // What the coils are doing, and how many pulses are left of a pulsed hold
+  CoilState coil_state[N];
+  OptionalArray<Traits::IDLE_HOLD, uint16_t, N> hold_pulses_left;
+
+#if MOTION_TRACE_LENGTH > 0
+  // Motion trace (see GetMotionTrace()): a ring buffer of recent events, where the next one goes, whether it has
+  // wrapped around yet, the last status recorded, and how many more events to record (or MOTION_TRACE_RECORDING)
+  MotionTraceEvent trace[N][MOTION_TRACE_LENGTH];
+  uint8_t trace_next[N];
+  bool trace_wrapped[N];
+  uint8_t trace_status[N];
+  uint8_t trace_events_left[N];
+  static const uint8_t MOTION_TRACE_RECORDING = 0xFF;
+
+  static_assert((MOTION_TRACE_LENGTH & (MOTION_TRACE_LENGTH - 1)) == 0, "MOTION_TRACE_LENGTH must be a power of 2");
+  static_assert(MOTION_TRACE_LENGTH <= 128, "MOTION_TRACE_LENGTH must fit in the trace indices");
+#endif
 
-  void Panic(String message);
-  bool CheckSensor();
-  void SetMotor(uint8_t out);
+  // Last value written to each module's motor outputs. Neighboring modules share a byte of output, so this lets us
+  // skip the read-modify-write of that byte whenever a module's output isn't changing (e.g. while idle).
+  uint8_t current_motor_out[N];
+
+  // Step scheduler: a binary min-heap of module indices, ordered by next_step_micros. heap_position maps a module back
+  // to its slot in the heap (or NOT_SCHEDULED) so modules can be added without searching.
+  static const uint8_t NOT_SCHEDULED = 0xFF;
+  unsigned long next_step_micros[N];
+  uint8_t heap[N];
+  uint8_t heap_position[N];
+  uint8_t heap_size;
+
+  void Panic(uint8_t i, String message);
+  void ResetSensor(uint8_t i);
+  void SampleSensors(unsigned long sample_micros);
+  void UpdateAt(unsigned long now, unsigned long sensor_sample_micros);
+  bool TakeHomeEdge(uint8_t i);
+  void SetMotor(uint8_t i, uint8_t out);
+  void UpdateModule(uint8_t i);
+  uint32_t UpdateHold(uint8_t i);
+  void TraceEvent(uint8_t i, uint16_t data);
+  void TraceStatus(uint8_t i);
+  void StopMotionTrace(uint8_t i);
+  uint16_t GetStepPeriod(uint8_t i, const uint16_t *step_periods, uint16_t accel_step);
 
   uint8_t GetFlapFloor(uint32_t step);
-  uint32_t GetTargetStepForFlapIndex(uint32_t from_step, uint8_t target_flap_index);
-  void GoToTargetFlapIndex();
-  void UpdateExpectedHome();
+  uint32_t GetTargetStepForFlapIndex(uint8_t i, uint8_t from_flap, uint8_t target_flap_index);
+  void GoToTargetFlapIndex(uint8_t i);
+  void UpdateExpectedHome(uint8_t i);
+  void BackOffSpeed(uint8_t i);
+  void RecordCleanRevolution(uint8_t i);
+  void RecordHomeOffsetSample(uint8_t i);
+  void SearchForHome(uint8_t i, HomeSearch search, uint32_t steps_to_home);
+  uint32_t StepsUntil(uint8_t i, uint32_t step);
+  uint16_t GetHomingAccelStep(uint8_t i);
+  uint16_t SlowDownForHome(uint8_t i, uint16_t target_accel_step, uint32_t steps_to_home);
+  int32_t GetHomeEdgeError(uint8_t i);
+  void PinHomeEdge(uint8_t i);
+
+  void Schedule(uint8_t i);
+  bool StepsBefore(uint8_t a, uint8_t b);
+  void HeapSet(uint8_t position, uint8_t i);
+  void SiftUp(uint8_t position);
+  void SiftDown(uint8_t position);
 
  public:
-  SplitflapModule(
+  SplitflapModuleBank();
+
+  State state[N];
+  uint16_t current_accel_step[N];
+
+  uint8_t count_unexpected_home[N];
+  uint8_t count_missed_home[N];
+
+  // Learned number of accel steps to hold back from the top of the acceleration profile (see
+  // ADAPTIVE_SPEED_BACKOFF_DIVISOR). Kept relative to the top of the profile so it still applies if the profile changes.
+  // As wide as an accel step, since a long ramp can back off by more than 255 steps. Always 0 without
+  // Traits::ADAPTIVE_SPEED.
+  OptionalArray<Traits::ADAPTIVE_SPEED, uint16_t, N> accel_step_backoff;
+
+  // Learned position of the home sensor edge, in steps after (or, if negative, before) where the gearing puts flap 0,
+  // e.g. because of where the magnet or sensor sits on this module. Finding home puts the edge at this step rather than
+  // at step 0, so every flap position (and with it every move) is shifted to match, and the home windows are centred
+  // on it. Measured by StartHomeOffsetCalibration(), and always 0 without Traits::HOME_OFFSET_CALIBRATION.
+  OptionalArray<Traits::HOME_OFFSET_CALIBRATION, int8_t, N> home_offset;
+
+  void Configure(
+    uint8_t i,
     uint8_t &motor_out,
     const uint8_t motor_bitshift,
     uint8_t &sensor_in,
     const uint8_t sensor_bitmask
   );
 
-#if HOME_CALIBRATION_ENABLED
-  State state = SENSOR_ERROR; // Start in SENSOR_ERROR state until initialized
-#else
-  State state = NORMAL;
-#endif
-  uint8_t current_accel_step = 0;
-
-  void GoToFlapIndex(uint8_t index);
-  uint8_t GetCurrentFlapIndex();
-  uint8_t GetTargetFlapIndex();
-  void GoHome();
-  void ResetErrorCounters();
-  void ResetState();
+  void GoToFlapIndex(uint8_t i, uint8_t index);
+  uint8_t GetCurrentFlapIndex(uint8_t i);
+  uint8_t GetTargetFlapIndex(uint8_t i);
+  uint16_t GetMaxAccelStep(uint8_t i);
+  bool IsMoving(uint8_t i);
+  void GoHome(uint8_t i);
+  void ResetErrorCounters(uint8_t i);
+  void ResetState(uint8_t i);
   inline void Update();
-  void Init();
-  bool GetHomeState();
-  void Disable();
-  
-  uint8_t count_unexpected_home = 0;
-  uint8_t count_missed_home = 0;
+  inline void Update(unsigned long sensor_sample_micros);
+  bool GetNextStepMicros(unsigned long &step_micros);
+  uint32_t GetMicrosToArrival(uint8_t i);
+  uint32_t EstimateMicrosToFlapIndex(uint8_t i, uint8_t index);
+  uint32_t EstimateTravelMicros(uint8_t i, uint16_t accel_step, uint32_t delta);
+  void Init(uint8_t i);
+  bool GetHomeState(uint8_t i);
+  void Disable(uint8_t i);
+  void SetAccelerationProfile(uint8_t i, const Acceleration::Profile &profile);
+  void SetPeriodScale(uint8_t i, uint16_t scale);
+  bool StartHomeOffsetCalibration(uint8_t i);
+  bool IsCalibratingHomeOffset(uint8_t i);
+  uint32_t GetCurrentStep(uint8_t i);
+  bool RestorePosition(uint8_t i, uint32_t step, uint8_t flap_index);
+  void SetIdleHold(uint8_t i, uint16_t settle_millis, uint8_t hold_percent, uint16_t hold_millis);
+  void ReleaseHold(uint8_t i);
+  CoilState GetCoilState(uint8_t i);
+  uint8_t GetMotionTrace(uint8_t i, MotionTraceEvent *out);
+  bool IsMotionTraceStopped(uint8_t i);
+  void RestartMotionTrace(uint8_t i);
+
+  static const uint16_t PERIOD_SCALE_ONE = 256;
 };
 
 
@@ -144,85 +459,274 @@ class SplitflapModule {
 #define MOT_PHASE_C B00000010
 #define MOT_PHASE_D B00000001
 
+#if HALF_STEP
+// Alternates between one and two coils energized
 const uint8_t step_pattern[] = {
 #if REVERSE_MOTOR_DIRECTION
   MOT_PHASE_D | MOT_PHASE_A,
+  MOT_PHASE_D,
   MOT_PHASE_C | MOT_PHASE_D,
+  MOT_PHASE_C,
   MOT_PHASE_B | MOT_PHASE_C,
+  MOT_PHASE_B,
   MOT_PHASE_A | MOT_PHASE_B,
+  MOT_PHASE_A,
 #else
   MOT_PHASE_A | MOT_PHASE_B,
+  MOT_PHASE_B,
   MOT_PHASE_B | MOT_PHASE_C,
+  MOT_PHASE_C,
   MOT_PHASE_C | MOT_PHASE_D,
+  MOT_PHASE_D,
   MOT_PHASE_D | MOT_PHASE_A,
+  MOT_PHASE_A,
 #endif
 };
+#else
+const uint8_t step_pattern[] = {
+#if REVERSE_MOTOR_DIRECTION
+  MOT_PHASE_D | MOT_PHASE_A,
+  MOT_PHASE_C | MOT_PHASE_D,
+  MOT_PHASE_B | MOT_PHASE_C,
+  MOT_PHASE_A | MOT_PHASE_B,
+#else
+  MOT_PHASE_A | MOT_PHASE_B,
+  MOT_PHASE_B | MOT_PHASE_C,
+  MOT_PHASE_C | MOT_PHASE_D,
+  MOT_PHASE_D | MOT_PHASE_A,
+#endif
+};
+#endif
 
-SplitflapModule::SplitflapModule(
+template <uint8_t N, typename Traits>
+SplitflapModuleBank<N, Traits>::SplitflapModuleBank() : heap_size(0) {
+  for (uint8_t i = 0; i < N; i++) {
+    motor_out[i] = nullptr;
+    motor_bitshift[i] = 0;
+    sensor_in[i] = nullptr;
+    sensor_bitmask[i] = 0;
+
+    last_home[i] = false;
+    home_change_pending[i] = false;
+    home_change_micros[i] = 0;
+    home_edge_step[i] = 0;
+    home_edge_fraction[i] = 0;
+    home_edge_pending[i] = false;
+    home_search[i] = HOME_SEARCH_COARSE;
+    home_search_fast_steps[i] = 0;
+    home_approach_pending[i] = false;
+    target_flap_index[i] = 0;
+    current_step[i] = 0;
+    delta_steps[i] = 0;
+    current_flap[i] = 0;
+
+    home_state[i] = IGNORE;
+    unexpected_home_start_step[i] = 0;
+    unexpected_home_end_step[i] = 0;
+    missed_home_step[i] = 0;
+    expected_home_step[i] = 0;
+    home_offset_samples_left[i] = 0;
+    home_offset_error_sum[i] = 0;
+    position_unverified[i] = false;
+
+    current_phase[i] = 0;
+    acceleration_profile[i] = Acceleration::DEFAULT_PROFILE;
+    current_period[i] = pgm_read_word_near(Acceleration::DEFAULT_PROFILE->accel_step_periods);
+    period_scale[i] = PERIOD_SCALE_ONE;
+    clean_revolutions[i] = 0;
+    settle_millis[i] = 0;
+    hold_on_micros[i] = 0;
+    hold_off_micros[i] = 0;
+    hold_pulses[i] = 0;
+    coil_state[i] = COIL_OFF;
+    hold_pulses_left[i] = 0;
+#if MOTION_TRACE_LENGTH > 0
+    trace_next[i] = 0;
+    trace_wrapped[i] = false;
+    // Unlike any real status, so that the first update records the module's status
+    trace_status[i] = 0xFF;
+    trace_events_left[i] = MOTION_TRACE_RECORDING;
+#endif
+    current_motor_out[i] = 0;
+
+    next_step_micros[i] = 0;
+    heap[i] = 0;
+    heap_position[i] = NOT_SCHEDULED;
+
+    // With home calibration, start in SENSOR_ERROR state until initialized
+    state[i] = Traits::HOME_CALIBRATION ? SENSOR_ERROR : NORMAL;
+    current_accel_step[i] = 0;
+    count_unexpected_home[i] = 0;
+    count_missed_home[i] = 0;
+    accel_step_backoff[i] = 0;
+    home_offset[i] = 0;
+  }
+}
+
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::Configure(
+  uint8_t i,
   uint8_t &motor_out,
   const uint8_t motor_bitshift,
   uint8_t &sensor_in,
-  const uint8_t sensor_bitmask) :
-    motor_out(motor_out),
-    motor_bitshift(motor_bitshift),
-    sensor_in(sensor_in),
-    sensor_bitmask(sensor_bitmask)
-{
+  const uint8_t sensor_bitmask) {
+  if (i >= N) {
+    return;
+  }
+  this->motor_out[i] = &motor_out;
+  this->motor_bitshift[i] = motor_bitshift;
+  this->sensor_in[i] = &sensor_in;
+  this->sensor_bitmask[i] = sensor_bitmask;
+}
+
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::Disable(uint8_t i) {
+  SetMotor(i, 0);
+  coil_state[i] = COIL_OFF;
+  state[i] = STATE_DISABLED;
+  TraceStatus(i);
+}
+
+// Switches a module to a different motion profile. Takes effect on the module's next step, even if it's already moving.
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::SetAccelerationProfile(uint8_t i, const Acceleration::Profile &profile) {
+  acceleration_profile[i] = &profile;
+  // Keep the current accel step in range of the new profile, in case it's shorter
+  if (current_accel_step[i] > profile.max_accel_step) {
+    current_accel_step[i] = profile.max_accel_step;
+  }
 }
 
-void SplitflapModule::Disable() {
-  SetMotor(0);
-  state = STATE_DISABLED;
+// Slows down (scale > PERIOD_SCALE_ONE) or speeds up (scale < PERIOD_SCALE_ONE) a module relative to its acceleration
+// profile, e.g. PERIOD_SCALE_ONE * 2 runs at half speed.
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::SetPeriodScale(uint8_t i, uint16_t scale) {
+  period_scale[i] = scale;
 }
 
-void SplitflapModule::Panic(String message) {
-  SetMotor(0);
-  state = PANIC;
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::Panic(uint8_t i, String message) {
+  SetMotor(i, 0);
+  coil_state[i] = COIL_OFF;
+  state[i] = PANIC;
+  TraceStatus(i);
+  StopMotionTrace(i);
   Serial.print("#### PANIC! ####\n");
+  Serial.print(i);
+  Serial.print(": ");
   Serial.print(message);
 }
 
+// Takes the home sensor's current reading as its debounced state, forgetting any edge that hasn't been acted on yet
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::ResetSensor(uint8_t i) {
+    last_home[i] = GetHomeState(i);
+    home_change_pending[i] = false;
+    home_edge_pending[i] = false;
+}
+
+// Samples the home sensor of every moving module. This runs on every Update() pass (i.e. every I/O cycle) rather than
+// once per step, so rising edges are debounced (by the time between samples) and located between steps: the edge is
+// placed at sample_micros (when the I/O latched the sensor inputs) of its first high sample, interpolated between the
+// steps either side of it.
+template <uint8_t N, typename Traits>
 __attribute__((always_inline))
-inline bool SplitflapModule::CheckSensor() {
-    bool cur_home = (sensor_in & sensor_bitmask) != 0;
-    bool shift = cur_home == true && last_home == false;
-    last_home = cur_home;
+inline void SplitflapModuleBank<N, Traits>::SampleSensors(unsigned long sample_micros) {
+    if (!Traits::HOME_CALIBRATION) {
+        return;
+    }
+    // Modules that aren't scheduled aren't moving, so their sensors can't have any edges worth knowing about
+    for (uint8_t h = 0; h < heap_size; h++) {
+        uint8_t i = heap[h];
+        bool cur_home = GetHomeState(i);
+        if (cur_home == last_home[i]) {
+            home_change_pending[i] = false;
+            continue;
+        }
 
-    return shift;
+        if (!home_change_pending[i]) {
+            home_change_pending[i] = true;
+            home_change_micros[i] = (uint16_t)sample_micros;
+            if (cur_home) {
+                // Possible rising edge; note where the module was when the sensor was latched, in case it holds up
+                long since_step = (long)(sample_micros - (next_step_micros[i] - current_period[i]));
+                uint32_t step = current_step[i];
+                if (since_step < 0) {
+                    // Latched before the module's latest step (e.g. by a transfer that overlapped the last pass), so
+                    // the edge was in the step before. That step's period is close enough to the current one to
+                    // interpolate.
+                    step = (step == 0 ? Geometry::GEAR_RATIO_INPUT_STEPS : step) - 1;
+                    since_step += (long)current_period[i];
+                    if (since_step < 0) {
+                        since_step = 0;
+                    }
+                }
+                home_edge_step[i] = step;
+                home_edge_fraction[i] = (unsigned long)since_step >= current_period[i]
+                    ? 255
+                    : (unsigned long)since_step * 256 / current_period[i];
+            }
+        }
+        if ((uint16_t)((uint16_t)sample_micros - home_change_micros[i]) >= Traits::HOME_SENSOR_DEBOUNCE_MICROS) {
+            last_home[i] = cur_home;
+            home_change_pending[i] = false;
+            if (cur_home) {
+                home_edge_pending[i] = true;
+            }
+        }
+    }
 }
 
+// Returns whether the home sensor has had a rising edge since the last call
+template <uint8_t N, typename Traits>
 __attribute__((always_inline))
-inline void SplitflapModule::SetMotor(uint8_t out) {
-  motor_out = (motor_out & ~(0x0F << motor_bitshift)) | ((out & 0x0F) << motor_bitshift);
+inline bool SplitflapModuleBank<N, Traits>::TakeHomeEdge(uint8_t i) {
+    bool edge = home_edge_pending[i];
+    home_edge_pending[i] = false;
+    return edge;
 }
 
+template <uint8_t N, typename Traits>
 __attribute__((always_inline))
-inline uint8_t SplitflapModule::GetFlapFloor(uint32_t step) {
-    return step * GEAR_RATIO_OUTPUT_FLAPS / GEAR_RATIO_INPUT_STEPS;
+inline void SplitflapModuleBank<N, Traits>::SetMotor(uint8_t i, uint8_t out) {
+  if (out == current_motor_out[i]) {
+    return;
+  }
+  current_motor_out[i] = out;
+  *motor_out[i] = (*motor_out[i] & ~(0x0F << motor_bitshift[i])) | ((out & 0x0F) << motor_bitshift[i]);
 }
 
+template <uint8_t N, typename Traits>
 __attribute__((always_inline))
-inline uint32_t SplitflapModule::GetTargetStepForFlapIndex(uint32_t from_step, uint8_t target_flap_index) {
-
-#if ASSERTIONS_ENABLED
-    //assert 0 <= from_step < 2*GEAR_RATIO_INPUT_STEPS
-    if (from_step < 0 || from_step >= 2 * GEAR_RATIO_INPUT_STEPS) {
-        Panic("from_step < 0 || from_step >= 2 * GEAR_RATIO_INPUT_STEPS");
+inline uint8_t SplitflapModuleBank<N, Traits>::GetFlapFloor(uint32_t step) {
+    // Binary search for the last flap that starts at or before step. Only valid for step < GEAR_RATIO_INPUT_STEPS,
+    // which is always the case since steps are kept modulo GEAR_RATIO_INPUT_STEPS.
+    uint8_t low = 0;
+    uint8_t high = Geometry::GEAR_RATIO_OUTPUT_FLAPS;
+    while (high - low > 1) {
+        uint8_t mid = (low + high) / 2;
+        if (pgm_read_word_near(FirstSteps::first_step + mid) <= step) {
+            low = mid;
+        } else {
+            high = mid;
+        }
     }
-#endif
-
-    uint8_t from_flap = GetFlapFloor(from_step);
+    return low;
+}
 
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline uint32_t SplitflapModuleBank<N, Traits>::GetTargetStepForFlapIndex(uint8_t i, uint8_t from_flap, uint8_t target_flap_index) {
 #if ASSERTIONS_ENABLED
     //assert 0 <= from_flap < 2*NUM_FLAPS
-    if (from_flap < 0 || from_flap >= 2 * NUM_FLAPS) {
-        Panic("from_flap < 0 || from_flap >= 2 * NUM_FLAPS");
+    if (from_flap < 0 || from_flap >= 2 * Traits::FLAP_COUNT) {
+        Panic(i, "from_flap < 0 || from_flap >= 2 * NUM_FLAPS");
     }
 #endif
 
     uint8_t from_flap_index;
-    if (from_flap >= NUM_FLAPS) {
-        from_flap_index = from_flap - NUM_FLAPS;
+    if (from_flap >= Traits::FLAP_COUNT) {
+        from_flap_index = from_flap - Traits::FLAP_COUNT;
     } else {
         from_flap_index = from_flap;
     }
@@ -233,7 +737,7 @@ inline uint32_t SplitflapModule::GetTargetStepForFlapIndex(uint32_t from_step, u
     } else {
         // Even if we're exactly at the target flap index, still do a full revolution to get to the target flap
         // since we're working with rounded numbers
-        delta_flaps = NUM_FLAPS + target_flap_index - from_flap_index;
+        delta_flaps = Traits::FLAP_COUNT + target_flap_index - from_flap_index;
     }
 
 #if VERBOSE_LOGGING
@@ -244,69 +748,80 @@ inline uint32_t SplitflapModule::GetTargetStepForFlapIndex(uint32_t from_step, u
 
 #if ASSERTIONS_ENABLED
     //assert 0 < delta_flaps <= 40
-    if (delta_flaps <= 0 || delta_flaps > NUM_FLAPS) {
-        Panic("delta_flaps <= 0 || delta_flaps > NUM_FLAPS");
+    if (delta_flaps <= 0 || delta_flaps > Traits::FLAP_COUNT) {
+        Panic(i, "delta_flaps <= 0 || delta_flaps > NUM_FLAPS");
     }
 #endif
 
-    uint32_t gear_ratio_input_steps_flaps_destination = ((uint32_t)from_flap + (uint32_t)delta_flaps) * GEAR_RATIO_INPUT_STEPS;
-
-    // Round UP when dividing so that the inverse calculation on the result (_get_flap_floor) returns the expected
-    // result.
-    uint32_t result = gear_ratio_input_steps_flaps_destination / GEAR_RATIO_OUTPUT_FLAPS;
-    if (gear_ratio_input_steps_flaps_destination % GEAR_RATIO_OUTPUT_FLAPS != 0) {
-        result++;
-    }
-    return result;
+    // Flap boundaries are rounded UP to a whole step so that the inverse calculation on the result (GetFlapFloor)
+    // returns the expected result. The home offset doesn't need adding here: finding home already puts the home edge at
+    // home_offset, so the whole frame of reference, flap boundaries included, is shifted by it.
+    return pgm_read_word_near(FirstSteps::first_step + from_flap + delta_flaps);
 }
 
+template <uint8_t N, typename Traits>
 __attribute__((always_inline))
-inline void SplitflapModule::GoToTargetFlapIndex() {
-    if (state != NORMAL) {
+inline void SplitflapModuleBank<N, Traits>::GoToTargetFlapIndex(uint8_t i) {
+    if (state[i] != NORMAL) {
         return;
     }
-    delta_steps = GetTargetStepForFlapIndex(current_step, target_flap_index) - current_step;
+    delta_steps[i] = GetTargetStepForFlapIndex(i, current_flap[i], target_flap_index[i]) - current_step[i];
 
 
 #if VERBOSE_LOGGING
     Serial.print("Going to flap index ");
-    Serial.print(target_flap_index);
+    Serial.print(target_flap_index[i]);
     Serial.print(". Current step is ");
-    Serial.print(current_step);
+    Serial.print(current_step[i]);
     Serial.print(". Delta is ");
-    Serial.print(delta_steps);
+    Serial.print(delta_steps[i]);
     Serial.print('\n');
 #endif
 
 #if ASSERTIONS_ENABLED
-    if (delta_steps > GEAR_RATIO_INPUT_STEPS) {
-        Panic("delta_steps > GEAR_RATIO_INPUT_STEPS");
+    if (delta_steps[i] > Geometry::GEAR_RATIO_INPUT_STEPS) {
+        Panic(i, "delta_steps > GEAR_RATIO_INPUT_STEPS");
     }
 #endif
 }
 
+template <uint8_t N, typename Traits>
 __attribute__((always_inline))
-inline void SplitflapModule::UpdateExpectedHome() {
-#if HOME_CALIBRATION_ENABLED
-    // Expected home position is the next 0 index flap position after the missed_home_step. This must be calculated
-    // from the missed_home_step, rather than current_step, so that in the event of an early home, we don't compute
-    // the next home as the one that is just a few steps away.
+inline void SplitflapModuleBank<N, Traits>::UpdateExpectedHome(uint8_t i) {
+    if (!Traits::HOME_CALIBRATION) {
+        return;
+    }
 
-    uint32_t expected_home = GetTargetStepForFlapIndex(missed_home_step, 0);
+    // Expected home position is the next 0 index flap position after the missed_home_step, shifted by the home
+    // offset. This must be calculated from the missed_home_step, rather than current_step, so that in the event of an
+    // early home, we don't compute the next home as the one that is just a few steps away. The offset comes off first,
+    // so that a negative one can't leave the missed_home_step on the flap before home. It's kept well within a flap
+    // (see RecordHomeOffsetSample), so one wrap either way is enough, and the result can't wrap below 0.
+
+    int32_t last_home = (int32_t)missed_home_step[i] - home_offset[i];
+    if (last_home < 0) {
+        last_home += Geometry::GEAR_RATIO_INPUT_STEPS;
+    } else if (last_home >= (int32_t)Geometry::GEAR_RATIO_INPUT_STEPS) {
+        last_home -= Geometry::GEAR_RATIO_INPUT_STEPS;
+    }
+    uint32_t expected_home = GetTargetStepForFlapIndex(i, GetFlapFloor(last_home), 0) + home_offset[i];
+    expected_home_step[i] = expected_home >= Geometry::GEAR_RATIO_INPUT_STEPS
+        ? expected_home - Geometry::GEAR_RATIO_INPUT_STEPS
+        : expected_home;
 
-    uint32_t new_unexpected_home_start_step = current_step + UNEXPECTED_HOME_START_BUFFER_STEPS;
-    uint32_t new_unexpected_home_end_step = expected_home - HOME_ERROR_MARGIN_STEPS;
-    uint32_t new_missed_home_step = expected_home + HOME_ERROR_MARGIN_STEPS;
+    uint32_t new_unexpected_home_start_step = current_step[i] + Geometry::UNEXPECTED_HOME_START_BUFFER_STEPS;
+    uint32_t new_unexpected_home_end_step = expected_home - Geometry::HOME_ERROR_MARGIN_STEPS;
+    uint32_t new_missed_home_step = expected_home + Geometry::HOME_ERROR_MARGIN_STEPS;
 
 #if VERBOSE_LOGGING
     Serial.print("Calculated new expected home ");
     Serial.print(expected_home);
     Serial.print(".\nOLD:us=");
-    Serial.print(unexpected_home_start_step);
+    Serial.print(unexpected_home_start_step[i]);
     Serial.print(", ue=");
-    Serial.print(unexpected_home_end_step);
+    Serial.print(unexpected_home_end_step[i]);
     Serial.print(", m=");
-    Serial.print(missed_home_step);
+    Serial.print(missed_home_step[i]);
     Serial.print("\nNEW:us=");
     Serial.print(new_unexpected_home_start_step);
     Serial.print(", ue=");
@@ -320,27 +835,27 @@ inline void SplitflapModule::UpdateExpectedHome() {
     // Values shouldn't be more than 2*GEAR_RATIO_INPUT_STEPS, so use subtraction to bound to GEAR_RATIO_INPUT_STEPS
     // rather than using `%` which may be more expensive
     //assert 0 <= new_unexpected_home_start_step < 2*GEAR_RATIO_INPUT_STEPS
-    if (new_unexpected_home_start_step >= 2 * GEAR_RATIO_INPUT_STEPS) {
-        Panic("new_unexpected_home_start_step >= 2 * GEAR_RATIO_INPUT_STEPS");
+    if (new_unexpected_home_start_step >= 2 * Geometry::GEAR_RATIO_INPUT_STEPS) {
+        Panic(i, "new_unexpected_home_start_step >= 2 * GEAR_RATIO_INPUT_STEPS");
     }
     //assert 0 <= new_unexpected_home_end_step < 2*GEAR_RATIO_INPUT_STEPS
-    if (new_unexpected_home_end_step >= 2 * GEAR_RATIO_INPUT_STEPS) {
-        Panic("new_unexpected_home_end_step >= 2 * GEAR_RATIO_INPUT_STEPS");
+    if (new_unexpected_home_end_step >= 2 * Geometry::GEAR_RATIO_INPUT_STEPS) {
+        Panic(i, "new_unexpected_home_end_step >= 2 * GEAR_RATIO_INPUT_STEPS");
     }
     //assert 0 <= new_missed_home_step < 2*GEAR_RATIO_INPUT_STEPS
-    if (new_missed_home_step >= 2 * GEAR_RATIO_INPUT_STEPS) {
-        Panic("new_missed_home_step >= 2 * GEAR_RATIO_INPUT_STEPS");
+    if (new_missed_home_step >= 2 * Geometry::GEAR_RATIO_INPUT_STEPS) {
+        Panic(i, "new_missed_home_step >= 2 * GEAR_RATIO_INPUT_STEPS");
     }
 #endif
 
-    if (new_unexpected_home_start_step >= GEAR_RATIO_INPUT_STEPS) {
-        new_unexpected_home_start_step -= GEAR_RATIO_INPUT_STEPS;
+    if (new_unexpected_home_start_step >= Geometry::GEAR_RATIO_INPUT_STEPS) {
+        new_unexpected_home_start_step -= Geometry::GEAR_RATIO_INPUT_STEPS;
     }
-    if (new_unexpected_home_end_step >= GEAR_RATIO_INPUT_STEPS) {
-        new_unexpected_home_end_step -= GEAR_RATIO_INPUT_STEPS;
+    if (new_unexpected_home_end_step >= Geometry::GEAR_RATIO_INPUT_STEPS) {
+        new_unexpected_home_end_step -= Geometry::GEAR_RATIO_INPUT_STEPS;
     }
-    if (new_missed_home_step >= GEAR_RATIO_INPUT_STEPS) {
-        new_missed_home_step -= GEAR_RATIO_INPUT_STEPS;
+    if (new_missed_home_step >= Geometry::GEAR_RATIO_INPUT_STEPS) {
+        new_missed_home_step -= Geometry::GEAR_RATIO_INPUT_STEPS;
     }
 
 #if ASSERTIONS_ENABLED
@@ -348,226 +863,868 @@ inline void SplitflapModule::UpdateExpectedHome() {
     // FULL revolutions.
     //assert new_unexpected_home_end_step > new_unexpected_home_start_step
     if (new_unexpected_home_end_step <= new_unexpected_home_start_step) {
-        Panic("new_unexpected_home_end_step <= new_unexpected_home_start_step");
+        Panic(i, "new_unexpected_home_end_step <= new_unexpected_home_start_step");
     }
 #endif
 
-    unexpected_home_start_step = new_unexpected_home_start_step;
-    unexpected_home_end_step = new_unexpected_home_end_step;
-    missed_home_step = new_missed_home_step;
-    home_state = IGNORE;
-#endif
+    unexpected_home_start_step[i] = new_unexpected_home_start_step;
+    unexpected_home_end_step[i] = new_unexpected_home_end_step;
+    missed_home_step[i] = new_missed_home_step;
+    home_state[i] = IGNORE;
 }
 
 
+template <uint8_t N, typename Traits>
 __attribute__((always_inline))
-inline void SplitflapModule::GoToFlapIndex(uint8_t index) {
-    if (state != NORMAL
-#if HOME_CALIBRATION_ENABLED
-     && state != LOOK_FOR_HOME
-#endif
-    ) {
+inline void SplitflapModuleBank<N, Traits>::GoToFlapIndex(uint8_t i, uint8_t index) {
+    if (state[i] != NORMAL && !(Traits::HOME_CALIBRATION && state[i] == LOOK_FOR_HOME)) {
         return;
     }
-    target_flap_index = index;
-    GoToTargetFlapIndex();
+    target_flap_index[i] = index;
+    GoToTargetFlapIndex(i);
+    Schedule(i);
 }
 
+template <uint8_t N, typename Traits>
 __attribute__((always_inline))
-inline uint8_t SplitflapModule::GetCurrentFlapIndex() {
-   return (uint8_t)(GetFlapFloor(current_step) % NUM_FLAPS);
+inline uint8_t SplitflapModuleBank<N, Traits>::GetCurrentFlapIndex(uint8_t i) {
+   // Flap floors span at most 2 output revolutions (see ModuleGeometry), so this is cheaper than % FLAP_COUNT
+   return current_flap[i] >= Traits::FLAP_COUNT ? current_flap[i] - Traits::FLAP_COUNT : current_flap[i];
 }
 
-uint8_t SplitflapModule::GetTargetFlapIndex() {
-   return target_flap_index;
+template <uint8_t N, typename Traits>
+uint8_t SplitflapModuleBank<N, Traits>::GetTargetFlapIndex(uint8_t i) {
+   return target_flap_index[i];
 }
 
+// Finds home from scratch, with a coarse search at full speed for roughly where the home sensor is. The module then
+// carries on to its target flap, and slows down to homing speed to pin the home edge down the next time it passes home
+// (modules can't back up, so going straight back over it would take another revolution).
+template <uint8_t N, typename Traits>
 __attribute__((always_inline))
-inline void SplitflapModule::GoHome() {
-#if HOME_CALIBRATION_ENABLED
-    if (state == PANIC || state == STATE_DISABLED) {
+inline void SplitflapModuleBank<N, Traits>::GoHome(uint8_t i) {
+    SearchForHome(i, HOME_SEARCH_COARSE, 0);
+}
+
+// Starts (or switches to) a search for home. For searches that know roughly where home is, steps_to_home is how far
+// ahead it's expected to be.
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::SearchForHome(uint8_t i, HomeSearch search, uint32_t steps_to_home) {
+    if (!Traits::HOME_CALIBRATION || state[i] == PANIC || state[i] == STATE_DISABLED) {
         return;
     }
 
-    state = LOOK_FOR_HOME;
-    delta_steps = MAX_STEPS_LOOKING_FOR_HOME;
-#endif
+    state[i] = LOOK_FOR_HOME;
+    home_search[i] = search;
+    if (search == HOME_SEARCH_COARSE || search == HOME_SEARCH_SLOW) {
+        home_search_fast_steps[i] = search == HOME_SEARCH_COARSE ? Geometry::MAX_STEPS_LOOKING_FOR_HOME : 0;
+        delta_steps[i] = Geometry::MAX_STEPS_LOOKING_FOR_HOME;
+    } else {
+        home_search_fast_steps[i] = steps_to_home > Geometry::HOME_APPROACH_STEPS
+            ? steps_to_home - Geometry::HOME_APPROACH_STEPS
+            : 0;
+        delta_steps[i] = steps_to_home + Geometry::HOME_APPROACH_STEPS;
+    }
+    // Any offset measurements so far were against the old frame of reference
+    home_offset_samples_left[i] = 0;
+    position_unverified[i] = false;
+    home_approach_pending[i] = false;
+    Schedule(i);
 }
 
+// Number of steps forward from the module's current step to the given one
+template <uint8_t N, typename Traits>
 __attribute__((always_inline))
-inline void SplitflapModule::Update() {
-    if (state == PANIC || state == STATE_DISABLED) {
+inline uint32_t SplitflapModuleBank<N, Traits>::StepsUntil(uint8_t i, uint32_t step) {
+    return step >= current_step[i] ? step - current_step[i] : step + Geometry::GEAR_RATIO_INPUT_STEPS - current_step[i];
+}
+
+// The speed modules search for home at, where the home sensor edge can be located precisely
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline uint16_t SplitflapModuleBank<N, Traits>::GetHomingAccelStep(uint8_t i) {
+    return acceleration_profile[i]->max_accel_step / 8;
+}
+
+// Limits a target accel step so that the module is down to homing speed by the time it's steps_to_home steps further on
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline uint16_t SplitflapModuleBank<N, Traits>::SlowDownForHome(uint8_t i, uint16_t target_accel_step, uint32_t steps_to_home) {
+    uint16_t homing_accel_step = GetHomingAccelStep(i);
+    if (target_accel_step <= homing_accel_step || steps_to_home >= (uint32_t)(target_accel_step - homing_accel_step)) {
+        return target_accel_step;
+    }
+    return homing_accel_step + steps_to_home;
+}
+
+// Where the latest home edge was relative to where it was expected (expected_home_step, which includes the home
+// offset), in 256ths of a step, allowing for either one being on the other side of the wrap back to step 0
+template <uint8_t N, typename Traits>
+int32_t SplitflapModuleBank<N, Traits>::GetHomeEdgeError(uint8_t i) {
+    int32_t error_steps = (int32_t)(home_edge_step[i] - expected_home_step[i]);
+    if (error_steps > (int32_t)Geometry::GEAR_RATIO_INPUT_STEPS / 2) {
+        error_steps -= Geometry::GEAR_RATIO_INPUT_STEPS;
+    } else if (error_steps < -(int32_t)Geometry::GEAR_RATIO_INPUT_STEPS / 2) {
+        error_steps += Geometry::GEAR_RATIO_INPUT_STEPS;
+    }
+    return error_steps * 256 + home_edge_fraction[i];
+}
+
+// Finishes a coarse home search: shifts the module's frame of reference so that the home edge just seen at homing speed
+// is where it's expected (home_offset steps from a home flap), as if it had been found by searching at homing speed in
+// the first place. The module's target flap stays put, so its remaining travel shifts along with it.
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::PinHomeEdge(uint8_t i) {
+    home_approach_pending[i] = false;
+    // Round to the nearest step
+    int32_t edge_error = GetHomeEdgeError(i);
+    int32_t error = edge_error >= 0 ? (edge_error + 128) / 256 : -((-edge_error + 127) / 256);
+    if (error == 0) {
         return;
     }
+    int32_t step = (int32_t)current_step[i] - error;
+    if (step < 0) {
+        step += Geometry::GEAR_RATIO_INPUT_STEPS;
+    } else if (step >= (int32_t)Geometry::GEAR_RATIO_INPUT_STEPS) {
+        step -= Geometry::GEAR_RATIO_INPUT_STEPS;
+    }
+    current_step[i] = step;
+    current_flap[i] = GetFlapFloor(step);
+    // If that puts the module past its target, it's by less than the home error margin, so just stop there
+    delta_steps[i] = error > 0 || delta_steps[i] > (uint32_t)-error ? delta_steps[i] + error : 0;
+}
 
+// Steps every module that's due. The sensor inputs are taken to have been read just now, as they are when the I/O
+// transfers synchronously right before each Update().
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N, Traits>::Update() {
+    // Read the clock once per pass rather than once per module
     unsigned long now = micros();
-    unsigned long delta_time = now - last_update_micros;
-    if (delta_time >= current_period) {
-        last_update_micros = now;
+    UpdateAt(now, now);
+}
 
-        uint8_t target_accel_step;
+// Like Update(), for I/O that latched the sensor inputs at sensor_sample_micros, some time before this pass (e.g. an
+// SPI transfer that ran in the background during the previous pass). Home edges are then placed where the module was
+// at that time rather than where it is now.
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N, Traits>::Update(unsigned long sensor_sample_micros) {
+    UpdateAt(micros(), sensor_sample_micros);
+}
+
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N, Traits>::UpdateAt(unsigned long now, unsigned long sensor_sample_micros) {
+    SampleSensors(sensor_sample_micros);
+    while (heap_size > 0) {
+        uint8_t i = heap[0];
+        if ((long)(now - next_step_micros[i]) < 0) {
+            // Nothing else is due yet
+            break;
+        }
+
+        // Modules that were disabled (or panicked) while scheduled are simply dropped here
+        unsigned long wait_micros = 0;
+        if (state[i] != PANIC && state[i] != STATE_DISABLED) {
+            if (coil_state[i] >= COIL_SETTLING && !IsMoving(i)) {
+                wait_micros = UpdateHold(i);
+            } else {
+                UpdateModule(i);
+                wait_micros = coil_state[i] == COIL_SETTLING ? settle_millis[i] * 1000UL : current_period[i];
+            }
+        }
+
+        if (state[i] != PANIC && state[i] != STATE_DISABLED && (IsMoving(i) || coil_state[i] >= COIL_SETTLING)) {
+            // Reschedule in place; the deadline only ever increases, so it can only move down the heap
+            next_step_micros[i] = now + wait_micros;
+            SiftDown(0);
+        } else {
+            heap_position[i] = NOT_SCHEDULED;
+            heap_size--;
+            if (N > 1 && heap_size > 0) {
+                HeapSet(0, heap[heap_size]);
+                SiftDown(0);
+            }
+        }
+    }
+}
+
+template <uint8_t N, typename Traits>
+bool SplitflapModuleBank<N, Traits>::GetNextStepMicros(unsigned long &step_micros) {
+    if (heap_size == 0) {
+        return false;
+    }
+    step_micros = next_step_micros[heap[0]];
+    return true;
+}
+
+// A module needs to keep being updated until it has come to a stop with nowhere left to go
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline bool SplitflapModuleBank<N, Traits>::IsMoving(uint8_t i) {
+    return current_accel_step[i] > 0
+        || (delta_steps[i] > 0 && (state[i] == NORMAL || state[i] == LOOK_FOR_HOME));
+}
+
+// Adds a module to the step scheduler, due immediately. Does nothing if it's already scheduled, unless it's only
+// scheduled to carry on an idle hold, which a move cuts short.
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::Schedule(uint8_t i) {
+    if (!IsMoving(i)) {
+        return;
+    }
+    if (heap_position[i] != NOT_SCHEDULED) {
+        if (coil_state[i] >= COIL_SETTLING) {
+            next_step_micros[i] = micros();
+            SiftUp(heap_position[i]);
+        }
+        return;
+    }
+    next_step_micros[i] = micros();
+    HeapSet(heap_size, i);
+    heap_size++;
+    SiftUp(heap_size - 1);
+}
+
+// Compares deadlines in a way that's safe across micros() overflow, as long as they're within ~35 minutes of each other
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline bool SplitflapModuleBank<N, Traits>::StepsBefore(uint8_t a, uint8_t b) {
+    return (long)(next_step_micros[a] - next_step_micros[b]) < 0;
+}
+
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N, Traits>::HeapSet(uint8_t position, uint8_t i) {
+    heap[position] = i;
+    heap_position[i] = position;
+}
+
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::SiftUp(uint8_t position) {
+    uint8_t i = heap[position];
+    // position is always < N; saying so lets the compiler see that a bank of one module never moves anything
+    while (position > 0 && position < N) {
+        uint8_t parent = (position - 1) / 2;
+        if (!StepsBefore(i, heap[parent])) {
+            break;
+        }
+        HeapSet(position, heap[parent]);
+        position = parent;
+    }
+    HeapSet(position, i);
+}
+
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::SiftDown(uint8_t position) {
+    uint8_t i = heap[position];
+    while (true) {
+        // Use 16-bit math for the children, since they can overflow uint8_t when N is close to 255. heap_size never
+        // exceeds N, but checking against N as well lets the compiler see that for small banks (and fold it away).
+        uint16_t child = 2 * (uint16_t)position + 1;
+        if (child >= heap_size || child >= N) {
+            break;
+        }
+        if (child + 1 < heap_size && child + 1 < N && StepsBefore(heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!StepsBefore(heap[child], i)) {
+            break;
+        }
+        HeapSet(position, heap[child]);
+        position = child;
+    }
+    HeapSet(position, i);
+}
 
-        if (state == NORMAL) {
-            bool reset_to_home = false;
-#if HOME_CALIBRATION_ENABLED
-            bool found_home = CheckSensor();
-            if (home_state == IGNORE) {
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N, Traits>::UpdateModule(uint8_t i) {
+    const Acceleration::Profile &profile = *acceleration_profile[i];
+    uint16_t target_accel_step;
+
+    if (state[i] == NORMAL) {
+        bool reset_to_home = false;
+        // Where to look for home if there's a home error: how far ahead it was expected
+        uint32_t steps_to_home = 0;
+        bool found_home = Traits::HOME_CALIBRATION && TakeHomeEdge(i);
+        if (!Traits::HOME_CALIBRATION) {
+            // Open loop, so there's no home position to check
+        } else if (home_state[i] == IGNORE) {
 #if VERBOSE_LOGGING
-                if (found_home) {
-                    Serial.print("VERBOSE: Ignoring home");
-                }
+            if (found_home) {
+                Serial.print("VERBOSE: Ignoring home");
+            }
 #endif
-                if (current_step == unexpected_home_start_step) {
-                    home_state = UNEXPECTED;
+            if (current_step[i] == unexpected_home_start_step[i]) {
+                home_state[i] = UNEXPECTED;
+            }
+        } else if (home_state[i] == UNEXPECTED) {
+            if (found_home) {
+                // A restored or roughly found position that turns out to be wrong says nothing about how well the
+                // module is running
+                if (!position_unverified[i] && !home_approach_pending[i]) {
+                    count_unexpected_home[i]++;
+                    BackOffSpeed(i);
                 }
-            } else if (home_state == UNEXPECTED) {
-                if (found_home) {
-                  count_unexpected_home++;
 #if VERBOSE_LOGGING
-                    Serial.print("VERBOSE: Unexpected home! At ");
-                    Serial.print(current_step);
-                    Serial.print(". Unexpected range ");
-                    Serial.print(unexpected_home_start_step);
-                    Serial.print('-');
-                    Serial.print(unexpected_home_end_step);
-                    Serial.print("; missed at ");
-                    Serial.print(missed_home_step);
-                    Serial.print(".\n");
+                Serial.print("VERBOSE: Unexpected home! At ");
+                Serial.print(current_step[i]);
+                Serial.print(". Unexpected range ");
+                Serial.print(unexpected_home_start_step[i]);
+                Serial.print('-');
+                Serial.print(unexpected_home_end_step[i]);
+                Serial.print("; missed at ");
+                Serial.print(missed_home_step[i]);
+                Serial.print(".\n");
 #endif
-                    reset_to_home = true;
-                } else if (current_step == unexpected_home_end_step) {
-                    home_state = EXPECTED;
-                }
-            } else if (home_state == EXPECTED) {
-                if (FAKE_HOME_SENSOR || found_home) {
+                // Whatever that was, if it wasn't a glitch home should still be where it was expected
+                reset_to_home = true;
+                steps_to_home = StepsUntil(i, unexpected_home_end_step[i]) + Geometry::HOME_ERROR_MARGIN_STEPS;
+            } else if (current_step[i] == unexpected_home_end_step[i]) {
+                home_state[i] = EXPECTED;
+            }
+        } else if (home_state[i] == EXPECTED) {
+            if (Traits::FAKE_HOME_SENSOR || found_home) {
 #if VERBOSE_LOGGING
-                    Serial.print("VERBOSE: Found expected home.");
+                Serial.print("VERBOSE: Found expected home.");
 #endif
-                    UpdateExpectedHome();
-                } else if (current_step == missed_home_step) {
-                  count_missed_home++;
+                if (found_home && home_approach_pending[i]) {
+                    PinHomeEdge(i);
+                } else if (Traits::HOME_OFFSET_CALIBRATION && found_home && home_offset_samples_left[i] > 0) {
+                    RecordHomeOffsetSample(i);
+                }
+                position_unverified[i] = false;
+                UpdateExpectedHome(i);
+                RecordCleanRevolution(i);
+            } else if (current_step[i] == missed_home_step[i]) {
+                if (!position_unverified[i] && !home_approach_pending[i]) {
+                    count_missed_home[i]++;
+                    BackOffSpeed(i);
+                }
 #if VERBOSE_LOGGING
-                    Serial.print("VERBOSE: Missed expected home! At ");
-                    Serial.print(current_step);
-                    Serial.print(". Expected between ");
-                    Serial.print(unexpected_home_end_step);
-                    Serial.print(" and ");
-                    Serial.print(missed_home_step);
-                    Serial.print(".\n");
+                Serial.print("VERBOSE: Missed expected home! At ");
+                Serial.print(current_step[i]);
+                Serial.print(". Expected between ");
+                Serial.print(unexpected_home_end_step[i]);
+                Serial.print(" and ");
+                Serial.print(missed_home_step[i]);
+                Serial.print(".\n");
 #endif
-                    reset_to_home = true;
-                }
+                reset_to_home = true;
             }
-#endif
+        }
 
-            if (reset_to_home) {
-                GoHome();
-                target_accel_step = 0;
+        if (reset_to_home && home_approach_pending[i]) {
+            // The coarse search was fooled (e.g. by a glitch), so don't trust the sensor at full speed
+            SearchForHome(i, HOME_SEARCH_SLOW, 0);
+            target_accel_step = 0;
+        } else if (reset_to_home) {
+            // A missed home is most likely a few lost steps, leaving home just ahead
+            StopMotionTrace(i);
+            SearchForHome(i, HOME_SEARCH_NEAR_EXPECTED, steps_to_home);
+            target_accel_step = 0;
+        } else {
+            // Update speed based on distance to target
+            uint16_t max_accel_step = GetMaxAccelStep(i);
+            if (delta_steps[i] > max_accel_step) {
+                target_accel_step = max_accel_step;
             } else {
-                // Update speed based on distance to target
-                if (delta_steps > Acceleration::MAX_ACCEL_STEP) {
-                    target_accel_step = Acceleration::MAX_ACCEL_STEP;
-                } else {
-                    target_accel_step = delta_steps;
-                }
+                target_accel_step = delta_steps[i];
+            }
+            if (home_approach_pending[i] && home_state[i] != IGNORE) {
+                target_accel_step = SlowDownForHome(i, target_accel_step,
+                    home_state[i] == EXPECTED ? 0 : StepsUntil(i, unexpected_home_end_step[i]));
             }
-#if HOME_CALIBRATION_ENABLED
-        } else if (state == LOOK_FOR_HOME) {
-            bool found_home = CheckSensor();
-            if (FAKE_HOME_SENSOR || found_home) {
+        }
+    } else if (Traits::HOME_CALIBRATION && state[i] == LOOK_FOR_HOME) {
+        bool found_home = TakeHomeEdge(i);
+        if (home_search_fast_steps[i] > 0) {
+            home_search_fast_steps[i]--;
+        }
+
+        if (Traits::FAKE_HOME_SENSOR || found_home) {
 #if VERBOSE_LOGGING
-                Serial.print("VERBOSE: Found home!\n");
+            Serial.print("VERBOSE: Found home!\n");
 #endif
-                state = NORMAL;
-                target_accel_step = 0;
+            state[i] = NORMAL;
+            target_accel_step = 0;
 
-                // Reset frame of reference
-                current_step = 0;
-                unexpected_home_start_step = 0;
-                unexpected_home_end_step = 0;
-                missed_home_step = 0;
-                UpdateExpectedHome();
+            // Reset frame of reference so that the step nearest the home edge is step home_offset. The edge may have
+            // been seen a step or so before now, while it was being debounced.
+            int32_t step = found_home ? (int32_t)(current_step[i] - home_edge_step[i]) : 0;
+            if (step < 0) {
+                step += Geometry::GEAR_RATIO_INPUT_STEPS;
+            }
+            if (found_home && home_edge_fraction[i] >= 128) {
+                // Closer to the following step, which the module hasn't necessarily taken yet
+                step--;
+            }
+            step += home_offset[i];
+            if (step < 0) {
+                step += Geometry::GEAR_RATIO_INPUT_STEPS;
+            } else if (step >= (int32_t)Geometry::GEAR_RATIO_INPUT_STEPS) {
+                step -= Geometry::GEAR_RATIO_INPUT_STEPS;
+            }
+            current_step[i] = step;
+            current_flap[i] = GetFlapFloor(step);
+            // Measure the next home from this one
+            uint32_t home_step = home_offset[i] < 0 ? Geometry::GEAR_RATIO_INPUT_STEPS + home_offset[i] : home_offset[i];
+            unexpected_home_start_step[i] = 0;
+            unexpected_home_end_step[i] = 0;
+            missed_home_step[i] = home_step;
+            UpdateExpectedHome(i);
+
+            // Found at full speed, so only roughly
+            home_approach_pending[i] = found_home && home_search[i] == HOME_SEARCH_COARSE;
+
+            GoToTargetFlapIndex(i);
+        } else {
+            if (delta_steps[i] == 0 && home_search[i] == HOME_SEARCH_NEAR_EXPECTED) {
+                // Not just a glitch, so start again from scratch
+                SearchForHome(i, HOME_SEARCH_COARSE, 0);
+            } else if (delta_steps[i] == 0 && home_search[i] == HOME_SEARCH_COARSE) {
+                // Maybe the sensor can't keep up at full speed
+                SearchForHome(i, HOME_SEARCH_SLOW, 0);
+            }
 
-                GoToTargetFlapIndex();
-            } else {
-                if (delta_steps == 0) {
+            if (delta_steps[i] == 0) {
 #if VERBOSE_LOGGING
-                    Serial.print("VERBOSE: Gave up looking for home!\n");
+                Serial.print("VERBOSE: Gave up looking for home!\n");
 #endif
-                    state = SENSOR_ERROR;
-                    target_accel_step = 0;
-                } else {
-                    target_accel_step = Acceleration::MAX_ACCEL_STEP / 8;
-                }
+                state[i] = SENSOR_ERROR;
+                target_accel_step = 0;
+                StopMotionTrace(i);
+            } else {
+                // Full speed while there's room to slow down to homing speed before home could come up
+                target_accel_step = SlowDownForHome(i, GetMaxAccelStep(i), home_search_fast_steps[i]);
             }
-#endif
-        } else {
-            target_accel_step = 0;
         }
+    } else {
+        target_accel_step = 0;
+    }
 
-        // Update motor
-        if (current_accel_step < target_accel_step) {
-            current_accel_step++;
-        } else if (current_accel_step > target_accel_step) {
-            current_accel_step--;
-        }
+    // Update motor
+    const uint16_t *step_periods = profile.accel_step_periods;
+    if (current_accel_step[i] < target_accel_step) {
+        current_accel_step[i]++;
+    } else if (current_accel_step[i] > target_accel_step) {
+        current_accel_step[i]--;
+        step_periods = profile.decel_step_periods;
+    }
 
-        current_period = pgm_read_word_near(Acceleration::ACCEL_STEP_PERIODS + current_accel_step);
+    current_period[i] = GetStepPeriod(i, step_periods, current_accel_step[i]);
 
-        if (current_accel_step > 0) {
-            current_step++;
-            if (current_step == GEAR_RATIO_INPUT_STEPS) {
-                current_step = 0;
-            }
-            current_phase++;
-            if (current_phase == 4) {
-                current_phase = 0;
-            }
-            if (delta_steps > 0) {
-                delta_steps--;
-            }
-            SetMotor(step_pattern[current_phase]);
-        } else {
-            SetMotor(0);
+    if (current_accel_step[i] > 0) {
+        current_step[i]++;
+        if (current_step[i] == Geometry::GEAR_RATIO_INPUT_STEPS) {
+            current_step[i] = 0;
+            current_flap[i] = 0;
+        } else if (current_step[i] == pgm_read_word_near(FirstSteps::first_step + current_flap[i] + 1)) {
+            current_flap[i]++;
         }
+        current_phase[i]++;
+        if (current_phase[i] == sizeof(step_pattern)) {
+            current_phase[i] = 0;
+        }
+        if (delta_steps[i] > 0) {
+            delta_steps[i]--;
+        }
+        SetMotor(i, step_pattern[current_phase[i]]);
+        coil_state[i] = COIL_STEPPING;
+        TraceStatus(i);
+        TraceEvent(i, current_period[i] >> MOTION_TRACE_PERIOD_SHIFT);
+    } else if (Traits::IDLE_HOLD && coil_state[i] == COIL_STEPPING && state[i] == NORMAL && delta_steps[i] == 0
+            && (settle_millis[i] > 0 || hold_pulses[i] > 0)) {
+        // Just arrived, so keep the coils energized for a while (see SetIdleHold())
+        coil_state[i] = COIL_SETTLING;
+        hold_pulses_left[i] = hold_pulses[i];
+    } else {
+        SetMotor(i, 0);
+        coil_state[i] = COIL_OFF;
+    }
+    if (current_accel_step[i] == 0) {
+        TraceStatus(i);
+    }
 
 #if ASSERTIONS_ENABLED
-        // Check modular arithmetic invariant
-        if (current_step >= GEAR_RATIO_INPUT_STEPS) {
-            Panic("current_step >= GEAR_RATIO_INPUT_STEPS");
+    // Check modular arithmetic invariant
+    if (current_step[i] >= Geometry::GEAR_RATIO_INPUT_STEPS) {
+        Panic(i, "current_step >= GEAR_RATIO_INPUT_STEPS");
+    }
+#endif
+}
+
+// Moves a stopped module on to the next part of its idle hold. Returns how long until the part after that.
+template <uint8_t N, typename Traits>
+uint32_t SplitflapModuleBank<N, Traits>::UpdateHold(uint8_t i) {
+    if (coil_state[i] == COIL_PULSED_HOLD && current_motor_out[i] == 0) {
+        SetMotor(i, step_pattern[current_phase[i]]);
+        return hold_on_micros[i];
+    }
+
+    // Done settling, or at the end of a pulse
+    if (hold_pulses_left[i] == 0) {
+        ReleaseHold(i);
+        return 0;
+    }
+    if (hold_pulses_left[i] != IDLE_HOLD_FOREVER) {
+        hold_pulses_left[i]--;
+    }
+    coil_state[i] = COIL_PULSED_HOLD;
+    SetMotor(i, 0);
+    return hold_off_micros[i];
+}
+
+// Adds an event to a module's motion trace, along with the home sensor reading, unless recording has stopped
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N, Traits>::TraceEvent(uint8_t i, uint16_t data) {
+#if MOTION_TRACE_LENGTH > 0
+    if (trace_events_left[i] != MOTION_TRACE_RECORDING) {
+        if (trace_events_left[i] == 0) {
+            return;
         }
+        trace_events_left[i]--;
+    }
+    MotionTraceEvent &event = trace[i][trace_next[i]];
+    event.step = current_step[i];
+    event.data = data | (GetHomeState(i) ? MOTION_TRACE_SENSOR : 0);
+    trace_next[i] = (trace_next[i] + 1) & (MOTION_TRACE_LENGTH - 1);
+    if (trace_next[i] == 0) {
+        trace_wrapped[i] = true;
+    }
 #endif
+}
+
+// Adds a status event to a module's motion trace if its state or home state has changed since the last one
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline void SplitflapModuleBank<N, Traits>::TraceStatus(uint8_t i) {
+#if MOTION_TRACE_LENGTH > 0
+    uint8_t status = state[i] | (home_state[i] << 3);
+    if (status != trace_status[i]) {
+        trace_status[i] = status;
+        TraceEvent(i, MOTION_TRACE_STATUS | status);
     }
-    return;
+#endif
+}
+
+// Stops recording a module's motion trace after a few more events, so that what led up to an error isn't overwritten
+// before someone gets to look at it. Until RestartMotionTrace(), later errors leave the trace alone.
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::StopMotionTrace(uint8_t i) {
+#if MOTION_TRACE_LENGTH > 0
+    if (trace_events_left[i] == MOTION_TRACE_RECORDING) {
+        trace_events_left[i] = MOTION_TRACE_LENGTH / 4;
+    }
+#endif
 }
 
-void SplitflapModule::ResetErrorCounters() {
-  count_unexpected_home = 0;
-  count_missed_home = 0;
+// Looks up a step period from one of a module's acceleration tables, with its speed scaling applied
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline uint16_t SplitflapModuleBank<N, Traits>::GetStepPeriod(uint8_t i, const uint16_t *step_periods, uint16_t accel_step) {
+    uint32_t period = (uint32_t)pgm_read_word_near(step_periods + accel_step) * period_scale[i] / PERIOD_SCALE_ONE;
+    return period > 0xFFFF ? 0xFFFF : period;
+}
+
+// Estimates how long until a module makes the last step of its current move. Returns 0 if the module isn't headed
+// anywhere, or if its arrival time isn't known yet (e.g. while it's looking for home).
+template <uint8_t N, typename Traits>
+uint32_t SplitflapModuleBank<N, Traits>::GetMicrosToArrival(uint8_t i) {
+    if (state[i] != NORMAL || delta_steps[i] == 0 || heap_position[i] == NOT_SCHEDULED) {
+        return 0;
+    }
+    long until_next_step = (long)(next_step_micros[i] - micros());
+    return EstimateTravelMicros(i, current_accel_step[i], delta_steps[i]) + (until_next_step > 0 ? until_next_step : 0);
+}
+
+// Estimates how long a module would take to arrive at a flap if GoToFlapIndex were called now, without moving it.
+// Returns 0 if the module can't tell yet (e.g. while it's looking for home).
+template <uint8_t N, typename Traits>
+uint32_t SplitflapModuleBank<N, Traits>::EstimateMicrosToFlapIndex(uint8_t i, uint8_t index) {
+    if (state[i] != NORMAL) {
+        return 0;
+    }
+    uint32_t delta = GetTargetStepForFlapIndex(i, current_flap[i], index) - current_step[i];
+    uint32_t travel_micros = EstimateTravelMicros(i, current_accel_step[i], delta);
+    if (heap_position[i] != NOT_SCHEDULED && IsMoving(i)) {
+        // Already moving, so the move carries on from its next step rather than starting now
+        long until_next_step = (long)(next_step_micros[i] - micros());
+        travel_micros += until_next_step > 0 ? until_next_step : 0;
+    }
+    return travel_micros;
 }
 
-void SplitflapModule::ResetState() {
-    ResetErrorCounters();
-    CheckSensor();
+// Estimates how long a module takes to cover delta steps, from its first update to its last step, starting at the
+// given accel step. This plays the same speed rules as UpdateModule forward, but skips over the constant speed part of
+// the move in one go, so it costs at most a couple of passes over the acceleration table however long the move is.
+template <uint8_t N, typename Traits>
+uint32_t SplitflapModuleBank<N, Traits>::EstimateTravelMicros(uint8_t i, uint16_t accel_step, uint32_t delta) {
+    const Acceleration::Profile &profile = *acceleration_profile[i];
+    uint16_t max_accel_step = GetMaxAccelStep(i);
+    if (max_accel_step == 0) {
+        // A profile too short to ever get moving
+        return 0;
+    }
+    uint32_t travel_micros = 0;
+    while (delta > 0) {
+        if (accel_step == max_accel_step && delta > max_accel_step) {
+            // Cruising; every step until the slow down starts takes the same time
+            uint32_t cruise_steps = delta - max_accel_step;
+            travel_micros += cruise_steps * GetStepPeriod(i, profile.accel_step_periods, accel_step);
+            delta -= cruise_steps;
+            continue;
+        }
 
-    target_flap_index = 0;
-    current_step = 0;
-    delta_steps = 0;
+        uint16_t target_accel_step = delta > max_accel_step ? max_accel_step : delta;
+        const uint16_t *step_periods = profile.accel_step_periods;
+        if (accel_step < target_accel_step) {
+            accel_step++;
+        } else if (accel_step > target_accel_step) {
+            accel_step--;
+            step_periods = profile.decel_step_periods;
+        }
+
+        delta--;
+        if (delta > 0) {
+            travel_micros += GetStepPeriod(i, step_periods, accel_step);
+        }
+    }
+    return travel_micros;
+}
+
+// The fastest accel step this module will run at, after any learned backoff
+template <uint8_t N, typename Traits>
+__attribute__((always_inline))
+inline uint16_t SplitflapModuleBank<N, Traits>::GetMaxAccelStep(uint8_t i) {
+    uint16_t max_accel_step = acceleration_profile[i]->max_accel_step;
+    if (!Traits::ADAPTIVE_SPEED) {
+        return max_accel_step;
+    }
+    uint16_t max_backoff = max_accel_step - max_accel_step / ADAPTIVE_SPEED_MIN_DIVISOR;
+    return max_accel_step - (accel_step_backoff[i] < max_backoff ? accel_step_backoff[i] : max_backoff);
+}
 
-#if HOME_CALIBRATION_ENABLED
-    home_state = IGNORE;
-    unexpected_home_start_step = 0;
-    unexpected_home_end_step = 0;
-    missed_home_step = 0;
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::BackOffSpeed(uint8_t i) {
+    if (!Traits::ADAPTIVE_SPEED) {
+        return;
+    }
+    uint16_t max_accel_step = acceleration_profile[i]->max_accel_step;
+    uint16_t step = max_accel_step / ADAPTIVE_SPEED_BACKOFF_DIVISOR;
+    if (step == 0) {
+        step = 1;
+    }
+    uint16_t max_backoff = max_accel_step - max_accel_step / ADAPTIVE_SPEED_MIN_DIVISOR;
+    uint16_t backoff = accel_step_backoff[i] + step;
+    accel_step_backoff[i] = backoff < max_backoff ? backoff : max_backoff;
+    clean_revolutions[i] = 0;
+}
+
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::RecordCleanRevolution(uint8_t i) {
+    if (!Traits::ADAPTIVE_SPEED || accel_step_backoff[i] == 0) {
+        return;
+    }
+    clean_revolutions[i]++;
+    if (clean_revolutions[i] >= ADAPTIVE_SPEED_CLEAN_REVOLUTIONS) {
+        accel_step_backoff[i]--;
+        clean_revolutions[i] = 0;
+    }
+}
+
+// Starts measuring a module's home offset: over the next HOME_OFFSET_CALIBRATION_REVOLUTIONS passes of the home
+// sensor, how far the sensor edge shows up from where it's expected is averaged, and the module's home_offset moves by
+// that much. The module has to be kept moving (e.g. with full revolutions) for the measurement to finish. Returns false
+// if the module isn't homed, or if the bank's Traits leave out HOME_OFFSET_CALIBRATION.
+template <uint8_t N, typename Traits>
+bool SplitflapModuleBank<N, Traits>::StartHomeOffsetCalibration(uint8_t i) {
+    if (!Traits::HOME_OFFSET_CALIBRATION || state[i] != NORMAL) {
+        return false;
+    }
+    home_offset_samples_left[i] = HOME_OFFSET_CALIBRATION_REVOLUTIONS;
+    home_offset_error_sum[i] = 0;
+    return true;
+}
+
+template <uint8_t N, typename Traits>
+bool SplitflapModuleBank<N, Traits>::IsCalibratingHomeOffset(uint8_t i) {
+    return home_offset_samples_left[i] > 0;
+}
+
+template <uint8_t N, typename Traits>
+uint32_t SplitflapModuleBank<N, Traits>::GetCurrentStep(uint8_t i) {
+    return current_step[i];
+}
+
+// Puts a module back at a position it was known to be stopped at (from GetCurrentStep() and GetTargetFlapIndex()),
+// e.g. one saved before a restart, instead of homing it. The position is trusted until the module next passes its home
+// sensor. If the sensor isn't where the position says it should be, the module goes back to homing without counting it
+// as a home error. Returns false (leaving the module alone) if the position isn't one a module could have stopped at.
+template <uint8_t N, typename Traits>
+bool SplitflapModuleBank<N, Traits>::RestorePosition(uint8_t i, uint32_t step, uint8_t flap_index) {
+    if (!Traits::HOME_CALIBRATION || state[i] == PANIC || state[i] == STATE_DISABLED
+            || step >= Geometry::GEAR_RATIO_INPUT_STEPS || flap_index >= Traits::FLAP_COUNT) {
+        return false;
+    }
+    // Modules only ever stop on the first step of their target flap
+    uint8_t flap = GetFlapFloor(step);
+    if (pgm_read_word_near(FirstSteps::first_step + flap) != step
+            || (flap >= Traits::FLAP_COUNT ? flap - Traits::FLAP_COUNT : flap) != flap_index) {
+        return false;
+    }
+
+    state[i] = NORMAL;
+    target_flap_index[i] = flap_index;
+    current_step[i] = step;
+    current_flap[i] = flap;
+    delta_steps[i] = 0;
+    home_offset_samples_left[i] = 0;
+    position_unverified[i] = true;
+    home_approach_pending[i] = false;
+
+    // Expect home at the next home flap after this one, as if the module had just found home here
+    missed_home_step[i] = step;
+    UpdateExpectedHome(i);
+    uint32_t steps_to_home_window = unexpected_home_end_step[i] >= step
+        ? unexpected_home_end_step[i] - step
+        : unexpected_home_end_step[i] + Geometry::GEAR_RATIO_INPUT_STEPS - step;
+    if (steps_to_home_window <= Geometry::UNEXPECTED_HOME_START_BUFFER_STEPS) {
+        // Too close to home for the usual buffer after finding home, which would hide the home window
+        unexpected_home_start_step[i] = step;
+    }
+    return true;
+}
+
+// Sets what a module does with its coils after each move. Releasing them straight away (the default, with everything
+// 0) saves the most current and heat, but a spool with a lot of inertia can bounce back off its flap. Instead the coils
+// can stay fully energized for settle_millis, then be pulsed on for hold_percent of the time for a further hold_millis
+// (or IDLE_HOLD_FOREVER), which holds the motor in place for a fraction of the current. Does nothing if the bank's
+// Traits leave out IDLE_HOLD.
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::SetIdleHold(uint8_t i, uint16_t settle_millis, uint8_t hold_percent, uint16_t hold_millis) {
+    if (!Traits::IDLE_HOLD) {
+        return;
+    }
+    const uint16_t pulse_millis = IDLE_HOLD_PULSE_PERIOD_MICROS / 1000;
+    if (hold_percent > 100) {
+        hold_percent = 100;
+    }
+    this->settle_millis[i] = settle_millis;
+    hold_on_micros[i] = (uint32_t)IDLE_HOLD_PULSE_PERIOD_MICROS * hold_percent / 100;
+    hold_off_micros[i] = IDLE_HOLD_PULSE_PERIOD_MICROS - hold_on_micros[i];
+    if (hold_percent == 0) {
+        hold_pulses[i] = 0;
+    } else if (hold_millis == IDLE_HOLD_FOREVER) {
+        hold_pulses[i] = IDLE_HOLD_FOREVER;
+    } else {
+        hold_pulses[i] = (hold_millis + pulse_millis - 1) / pulse_millis;
+    }
+}
+
+// Ends a module's idle hold early, de-energizing its coils. Does nothing if the module is moving.
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::ReleaseHold(uint8_t i) {
+    if (coil_state[i] >= COIL_SETTLING) {
+        SetMotor(i, 0);
+        coil_state[i] = COIL_OFF;
+    }
+}
+
+template <uint8_t N, typename Traits>
+CoilState SplitflapModuleBank<N, Traits>::GetCoilState(uint8_t i) {
+    return coil_state[i];
+}
+
+// Copies a module's motion trace (up to MOTION_TRACE_LENGTH of its most recent steps and state changes) into out,
+// oldest first. Returns the number of events copied, which is always 0 if MOTION_TRACE_LENGTH is 0.
+template <uint8_t N, typename Traits>
+uint8_t SplitflapModuleBank<N, Traits>::GetMotionTrace(uint8_t i, MotionTraceEvent *out) {
+#if MOTION_TRACE_LENGTH > 0
+    uint8_t count = trace_wrapped[i] ? MOTION_TRACE_LENGTH : trace_next[i];
+    uint8_t first = trace_wrapped[i] ? trace_next[i] : 0;
+    for (uint8_t e = 0; e < count; e++) {
+        out[e] = trace[i][(first + e) & (MOTION_TRACE_LENGTH - 1)];
+    }
+    return count;
+#else
+    return 0;
+#endif
+}
+
+// Whether a module's motion trace has stopped recording after an error
+template <uint8_t N, typename Traits>
+bool SplitflapModuleBank<N, Traits>::IsMotionTraceStopped(uint8_t i) {
+#if MOTION_TRACE_LENGTH > 0
+    return trace_events_left[i] != MOTION_TRACE_RECORDING;
+#else
+    return false;
 #endif
 }
 
-void SplitflapModule::Init() {
-    CheckSensor();
+// Clears a module's motion trace and starts recording again
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::RestartMotionTrace(uint8_t i) {
+#if MOTION_TRACE_LENGTH > 0
+    trace_next[i] = 0;
+    trace_wrapped[i] = false;
+    trace_events_left[i] = MOTION_TRACE_RECORDING;
+#endif
+}
+
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::RecordHomeOffsetSample(uint8_t i) {
+    home_offset_error_sum[i] += GetHomeEdgeError(i);
+
+    home_offset_samples_left[i]--;
+    if (home_offset_samples_left[i] > 0) {
+        return;
+    }
+
+    // The edges were measured against the current offset, so this refines it. Round to the nearest step, and keep the
+    // home windows within half a flap of where the gearing puts them.
+    const int32_t max_offset = Geometry::ROUGH_STEPS_PER_FLAP / 2 < 127 ? Geometry::ROUGH_STEPS_PER_FLAP / 2 : 127;
+    const int32_t samples = HOME_OFFSET_CALIBRATION_REVOLUTIONS * 256;
+    int32_t sum = home_offset_error_sum[i];
+    int32_t offset = home_offset[i] + (sum >= 0 ? (sum + samples / 2) / samples : -((-sum + samples / 2) / samples));
+    home_offset[i] = offset > max_offset ? max_offset : (offset < -max_offset ? -max_offset : offset);
+}
+
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::ResetErrorCounters(uint8_t i) {
+  count_unexpected_home[i] = 0;
+  count_missed_home[i] = 0;
+}
+
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::ResetState(uint8_t i) {
+    ResetErrorCounters(i);
+    ResetSensor(i);
+
+    target_flap_index[i] = 0;
+    current_step[i] = 0;
+    delta_steps[i] = 0;
+    current_flap[i] = 0;
+
+    home_state[i] = IGNORE;
+    unexpected_home_start_step[i] = 0;
+    unexpected_home_end_step[i] = 0;
+    missed_home_step[i] = 0;
+    position_unverified[i] = false;
+    home_approach_pending[i] = false;
+}
+
+template <uint8_t N, typename Traits>
+void SplitflapModuleBank<N, Traits>::Init(uint8_t i) {
+    ResetSensor(i);
 }
 
-bool SplitflapModule::GetHomeState() {
-  return (sensor_in & sensor_bitmask) != 0;
+template <uint8_t N, typename Traits>
+bool SplitflapModuleBank<N, Traits>::GetHomeState(uint8_t i) {
+  return (*sensor_in[i] & sensor_bitmask[i]) != 0;
 }
 
 #endif
@@ -17,8 +17,7 @@
 
 #include "../config.h"
 
-#if HOME_CALIBRATION_ENABLED
-enum HomeState {
+enum HomeState : uint8_t {
     // Ignore any home blips (e.g. if we've just seen the home position and haven't traveled past it yet)
     IGNORE,
     // Home isn't expected; a home blip in this state/region indicates an error that requires recalibration
@@ -26,12 +25,59 @@ enum HomeState {
     // Home position is expected in this state/region
     EXPECTED,
 };
-#endif
 
-enum State {
+// How a module in the LOOK_FOR_HOME state is searching for its home sensor
+enum HomeSearch : uint8_t {
+    // After a home error, checking around where home was expected, in case the error was a glitch or a few lost steps
+    HOME_SEARCH_NEAR_EXPECTED,
+    // At full speed, to find roughly where home is
+    HOME_SEARCH_COARSE,
+    // At homing speed all the way, in case the sensor can't be relied on at full speed
+    HOME_SEARCH_SLOW,
+};
+
+// What a module's motor coils are doing
+enum CoilState : uint8_t {
+    // De-energized
+    COIL_OFF,
+    // Driven by steps
+    COIL_STEPPING,
+    // Held at full current after a move, so the flaps settle
+    COIL_SETTLING,
+    // Held by short pulses of current, to keep the motor in place with less current and heat
+    COIL_PULSED_HOLD,
+};
+
+enum State : uint8_t {
   NORMAL,
   LOOK_FOR_HOME,
   SENSOR_ERROR,
   PANIC,
   STATE_DISABLED,
 };
+
+// One entry of a module's motion trace (see SplitflapModuleBank::GetMotionTrace), packed into 4 bytes so that recording
+// one per step is cheap enough to leave on
+struct MotionTraceEvent {
+    // Step the module was on (see SplitflapModuleBank::GetCurrentStep)
+    uint16_t step;
+    // MOTION_TRACE_SENSOR is the raw home sensor reading. If MOTION_TRACE_STATUS is set, the module's State changed to
+    // the value in the lowest 3 bits, with the HomeState in the next 2. Otherwise the module took a step, and the rest
+    // is the step's period in units of 1 << MOTION_TRACE_PERIOD_SHIFT microseconds.
+    uint16_t data;
+};
+
+#define MOTION_TRACE_SENSOR         0x8000
+#define MOTION_TRACE_STATUS         0x4000
+#define MOTION_TRACE_PERIOD_SHIFT   2
+
+namespace Acceleration {
+  // A motion profile: step periods indexed by accel step, with separate ramps for speeding up (or holding speed) and
+  // for slowing down. Both ramps have max_accel_step + 1 entries, stored in PROGMEM (or in RAM, on platforms like the
+  // ESP32 where PROGMEM is ordinary memory).
+  struct Profile {
+    const uint16_t *accel_step_periods;
+    const uint16_t *decel_step_periods;
+    uint16_t max_accel_step;
+  };
+}
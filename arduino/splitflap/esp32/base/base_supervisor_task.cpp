@@ -20,14 +20,21 @@
 #define PIN_UP_BUTTON           35
 #define PIN_DOWN_BUTTON         0
 
-
 /**
- * MODIFY THIS to configure which modules are connected to which power channels!
+ * Most current a power channel should draw with the given numbers of modules moving and homing. Moving modules get two
+ * modules' worth of headroom (or one, if none are moving) for the current spikes as they start and stop.
  */
-uint8_t BaseSupervisorTask::getPowerChannelForModuleIndex(uint8_t module_index) {
-    return module_index / 36;
+static constexpr uint32_t maxExpectedChannelCurrentMilliamps(uint32_t moving, uint32_t homing) {
+    return IDLE_CURRENT_MILLIAMPS
+            + homing * MAX_MODULE_CURRENT_HOMING_MA
+            + (moving > 0 ? (moving + 2) : 1) * MAX_MODULE_CURRENT_MOVING_MA;
 }
 
+static_assert(NUM_MODULE_POWER_CHANNELS <= NUM_POWER_CHANNELS, "More modules than the power channels can drive");
+static_assert(MAX_MOVING_MODULES_PER_POWER_CHANNEL == 0
+        || maxExpectedChannelCurrentMilliamps(MAX_MOVING_MODULES_PER_POWER_CHANNEL, 0) <= ABSOLUTE_MAX_CHANNEL_CURRENT_MA,
+        "MAX_MOVING_MODULES_PER_POWER_CHANNEL allows more current than a power channel can supply");
+
 /** Maps power channel index (0-4) to MCP GPIO pin. */
 static const uint8_t MCP_PIN_CHANNEL_EN[NUM_POWER_CHANNELS] = {
     5,
@@ -114,7 +121,7 @@ void BaseSupervisorTask::run() {
     // (This could technically be determined statically since the mapping is static, but it's
     // easier to just compute it at runtime)
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
-        channel_used_[getPowerChannelForModuleIndex(i)] = true;
+        channel_used_[SplitflapTask::getPowerChannelForModuleIndex(i)] = true;
     }
 
     while (1) {
@@ -233,7 +240,7 @@ void BaseSupervisorTask::runStateNormal() {
     uint8_t moving[NUM_POWER_CHANNELS] = {};
     uint8_t homing[NUM_POWER_CHANNELS] = {};
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
-        uint8_t power_channel = getPowerChannelForModuleIndex(i);
+        uint8_t power_channel = SplitflapTask::getPowerChannelForModuleIndex(i);
         if (splitflap_state_.modules[i].moving) {
             if (splitflap_state_.modules[i].state == State::LOOK_FOR_HOME) {
                 homing[power_channel]++;
@@ -252,9 +259,7 @@ void BaseSupervisorTask::runStateNormal() {
             }
 
             float min_expected_channel_current_ma = -5 + (moving[i] + homing[i]) * MIN_MODULE_CURRENT_MA;
-            float max_expected_channel_current_ma = IDLE_CURRENT_MILLIAMPS
-                    + homing[i] * MAX_MODULE_CURRENT_HOMING_MA
-                    + (moving[i] > 0 ? (moving[i] + 2) : 1) * MAX_MODULE_CURRENT_MOVING_MA;
+            float max_expected_channel_current_ma = maxExpectedChannelCurrentMilliamps(moving[i], homing[i]);
 
             if (current_amps_[i] * 1000 > max_expected_channel_current_ma) {
                 channel_current_out_of_range_count_[i]++;
@@ -37,8 +37,6 @@ class BaseSupervisorTask : public Task<BaseSupervisorTask> {
         void run();
 
     private:
-        static uint8_t getPowerChannelForModuleIndex(uint8_t module_index);
-
         SplitflapTask& splitflap_task_;
         SerialTask& serial_task_;
 
@@ -0,0 +1,221 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "config.h"
+
+#define FLAP_ALPHABET_NO_FLAP 0xFF
+#define UTF8_INVALID_CODEPOINT 0xFFFFFFFF
+
+static_assert(NUM_FLAPS < FLAP_ALPHABET_NO_FLAP, "Too many flaps for a FlapAlphabet lookup table");
+
+/**
+ * Decodes the UTF-8 character starting at *str (reading no further than end) and advances *str past it. Malformed
+ * sequences are consumed one byte at a time and decode to UTF8_INVALID_CODEPOINT.
+ */
+inline uint32_t decodeUtf8(const char** str, const char* end) {
+    const uint8_t* p = (const uint8_t*)*str;
+    uint8_t lead = p[0];
+    *str += 1;
+    if (lead < 0x80) {
+        return lead;
+    }
+
+    uint8_t continuation_bytes;
+    uint32_t codepoint;
+    uint32_t min_codepoint;
+    if ((lead & 0xE0) == 0xC0) {
+        continuation_bytes = 1;
+        codepoint = lead & 0x1F;
+        min_codepoint = 0x80;
+    } else if ((lead & 0xF0) == 0xE0) {
+        continuation_bytes = 2;
+        codepoint = lead & 0x0F;
+        min_codepoint = 0x800;
+    } else if ((lead & 0xF8) == 0xF0) {
+        continuation_bytes = 3;
+        codepoint = lead & 0x07;
+        min_codepoint = 0x10000;
+    } else {
+        return UTF8_INVALID_CODEPOINT;
+    }
+
+    if (end - (const char*)p <= continuation_bytes) {
+        return UTF8_INVALID_CODEPOINT;
+    }
+    for (uint8_t i = 1; i <= continuation_bytes; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            return UTF8_INVALID_CODEPOINT;
+        }
+        codepoint = (codepoint << 6) | (p[i] & 0x3F);
+    }
+    // Reject overlong encodings, surrogates, and values past the end of Unicode
+    if (codepoint < min_codepoint || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+        return UTF8_INVALID_CODEPOINT;
+    }
+    *str += continuation_bytes;
+    return codepoint;
+}
+
+/**
+ * Decodes like decodeUtf8(), except that a byte which doesn't start a valid UTF-8 sequence is taken to be a Latin-1
+ * (ISO 8859-1) character on its own, rather than UTF8_INVALID_CODEPOINT. This keeps clients that still send single-byte
+ * text working: valid UTF-8 is decoded as UTF-8, so only Latin-1 text that happens to also be valid UTF-8 (e.g. "\xC3\xA9")
+ * is misread.
+ */
+inline uint32_t decodeUtf8OrLatin1(const char** str, const char* end) {
+    uint8_t byte = (uint8_t)**str;
+    uint32_t codepoint = decodeUtf8(str, end);
+    return codepoint == UTF8_INVALID_CODEPOINT ? byte : codepoint;
+}
+
+/**
+ * Encodes codepoint as UTF-8 into out, which must have room for 4 bytes. Returns the number of bytes written.
+ */
+inline uint8_t encodeUtf8(uint32_t codepoint, char* out) {
+    if (codepoint < 0x80) {
+        out[0] = codepoint;
+        return 1;
+    } else if (codepoint < 0x800) {
+        out[0] = 0xC0 | (codepoint >> 6);
+        out[1] = 0x80 | (codepoint & 0x3F);
+        return 2;
+    } else if (codepoint < 0x10000) {
+        out[0] = 0xE0 | (codepoint >> 12);
+        out[1] = 0x80 | ((codepoint >> 6) & 0x3F);
+        out[2] = 0x80 | (codepoint & 0x3F);
+        return 3;
+    }
+    out[0] = 0xF0 | (codepoint >> 18);
+    out[1] = 0x80 | ((codepoint >> 12) & 0x3F);
+    out[2] = 0x80 | ((codepoint >> 6) & 0x3F);
+    out[3] = 0x80 | (codepoint & 0x3F);
+    return 4;
+}
+
+/**
+ * The characters printed on one kind of flap spool, in spool order starting from the home flap. Each flap is a single
+ * Unicode codepoint, so symbols and colour flaps can be given their own glyphs (e.g. U+1F7E5 for a red flap).
+ *
+ * Lookups of codepoints below 256 (which covers everything sent by ASCII and Latin-1 clients) go through a reverse lookup
+ * table; anything else is a binary search of the other codepoints, which are kept sorted.
+ */
+class FlapAlphabet {
+    public:
+        FlapAlphabet() {
+            uint32_t codepoints[NUM_FLAPS];
+            for (uint8_t i = 0; i < NUM_FLAPS; i++) {
+                codepoints[i] = flaps[i];
+            }
+            setCodepoints(codepoints);
+        }
+
+        /**
+         * Replaces the flaps with the characters of a UTF-8 string, which must contain exactly NUM_FLAPS characters.
+         * Returns false (leaving the alphabet unchanged) if it doesn't.
+         */
+        bool setUtf8(const char* str, size_t length) {
+            uint32_t codepoints[NUM_FLAPS];
+            const char* end = str + length;
+            uint8_t count = 0;
+            while (str < end) {
+                uint32_t codepoint = decodeUtf8(&str, end);
+                if (codepoint == UTF8_INVALID_CODEPOINT || count == NUM_FLAPS) {
+                    return false;
+                }
+                codepoints[count++] = codepoint;
+            }
+            if (count != NUM_FLAPS) {
+                return false;
+            }
+            setCodepoints(codepoints);
+            return true;
+        }
+
+        void setCodepoints(const uint32_t* codepoints) {
+            memset(byte_lookup_, FLAP_ALPHABET_NO_FLAP, sizeof(byte_lookup_));
+            // Fill in reverse so that if a character appears on more than one flap, it maps to the first
+            for (int16_t i = NUM_FLAPS - 1; i >= 0; i--) {
+                codepoints_[i] = codepoints[i];
+                if (codepoints[i] < sizeof(byte_lookup_)) {
+                    byte_lookup_[codepoints[i]] = i;
+                }
+            }
+
+            // Insertion sort the rest in flap order, so that a repeated character keeps its first flap
+            wide_count_ = 0;
+            for (uint8_t i = 0; i < NUM_FLAPS; i++) {
+                uint32_t codepoint = codepoints[i];
+                if (codepoint < sizeof(byte_lookup_)) {
+                    continue;
+                }
+                uint8_t position = wide_count_;
+                while (position > 0 && wide_codepoints_[position - 1] > codepoint) {
+                    position--;
+                }
+                if (position > 0 && wide_codepoints_[position - 1] == codepoint) {
+                    continue;
+                }
+                memmove(&wide_codepoints_[position + 1], &wide_codepoints_[position],
+                    (wide_count_ - position) * sizeof(wide_codepoints_[0]));
+                memmove(&wide_flaps_[position + 1], &wide_flaps_[position], wide_count_ - position);
+                wide_codepoints_[position] = codepoint;
+                wide_flaps_[position] = i;
+                wide_count_++;
+            }
+        }
+
+        const uint32_t* getCodepoints() const {
+            return codepoints_;
+        }
+
+        uint32_t getCodepoint(uint8_t flap_index) const {
+            return codepoints_[flap_index];
+        }
+
+        /**
+         * Returns the flap showing the given codepoint, or FLAP_ALPHABET_NO_FLAP if there isn't one.
+         */
+        uint8_t findFlapIndex(uint32_t codepoint) const {
+            if (codepoint < sizeof(byte_lookup_)) {
+                return byte_lookup_[codepoint];
+            }
+            uint8_t low = 0;
+            uint8_t high = wide_count_;
+            while (low < high) {
+                uint8_t mid = (low + high) / 2;
+                if (wide_codepoints_[mid] < codepoint) {
+                    low = mid + 1;
+                } else {
+                    high = mid;
+                }
+            }
+            return low < wide_count_ && wide_codepoints_[low] == codepoint ? wide_flaps_[low] : FLAP_ALPHABET_NO_FLAP;
+        }
+
+    private:
+        uint32_t codepoints_[NUM_FLAPS];
+        uint8_t byte_lookup_[256];
+
+        // Codepoints of 256 and up in ascending order, with the first flap showing each
+        uint32_t wide_codepoints_[NUM_FLAPS];
+        uint8_t wide_flaps_[NUM_FLAPS];
+        uint8_t wide_count_;
+};
@@ -27,13 +27,64 @@
 #include "splitflap_task.h"
 
 static_assert(QCMD_FLAP + NUM_FLAPS <= 255, "Too many flaps to fit in uint8_t command structure");
+static_assert(NUM_FLAPS <= NO_PENDING_FLAP, "Too many flaps to tell a pending flap from no pending flap");
+static_assert(Acceleration::S_CURVE_MAX_ACCEL_STEP + 1 <= MAX_PROFILE_LENGTH,
+        "An uploaded acceleration profile can't be as long as the built-in ramps");
 
-SplitflapTask::SplitflapTask(const uint8_t task_core, const LedMode led_mode) : Task("Splitflap", 2048, 1, task_core), led_mode_(led_mode), state_semaphore_(xSemaphoreCreateMutex()) {
+// Upper bound on how long the task sleeps between loop iterations when no module is due to step soon, so that LED
+// animations, sensor test updates, and the iterative loopback checks in runUpdate() keep running while idle.
+static const TickType_t MAX_IDLE_WAIT_TICKS = 1;
+
+// Minimum time between writes of changed settings to flash, to limit flash wear
+static const uint32_t SETTINGS_SAVE_INTERVAL_MILLIS = 60000;
+
+// Minimum time between refreshes of the arrival estimates in the cached state. They change with every step, so
+// refreshing them on every loop would mean publishing a new state on every loop.
+static const uint32_t ETA_UPDATE_INTERVAL_MILLIS = 100;
+
+// How long every module has to have been stopped before their positions are saved, so that a display that's busy
+// (e.g. running a sequence, or being sent a string every few seconds) writes to flash once per burst of moves rather
+// than after every one
+static const uint32_t POSITION_SAVE_DELAY_MILLIS = 10000;
+
+// How little of the task's stack can go unused before checkStackHighWaterMark() warns about it
+static const uint32_t STACK_FREE_WARNING_BYTES = 512;
+
+#if LOOP_BENCHMARK
+// How much time spent moving each logged loop benchmark covers
+static const uint32_t LOOP_BENCHMARK_INTERVAL_MICROS = 2000000;
+#endif
+
+static const char* SETTINGS_NAMESPACE = "splitflap";
+// 16 bits per module. Backoffs saved under the old key, at 8 bits per module, are left behind and relearned.
+static const char* SETTINGS_KEY_ACCEL_STEP_BACKOFF = "accel_backoff2";
+static const char* SETTINGS_KEY_HOME_OFFSET = "home_offset";
+static const char* SETTINGS_KEY_ALPHABETS = "alphabets";
+static const char* SETTINGS_KEY_MODULE_ALPHABET = "module_alphabet";
+static const char* SETTINGS_KEY_POSITIONS = "positions";
+static const char* SETTINGS_KEY_POSITIONS_SAVED = "positions_ok";
+
+/**
+ * MODIFY THIS (and NUM_MODULE_POWER_CHANNELS) to configure which modules are connected to which power channels!
+ */
+uint8_t SplitflapTask::getPowerChannelForModuleIndex(uint8_t module_index) {
+    return module_index / MODULES_PER_POWER_CHANNEL;
+}
+
+SplitflapTask::SplitflapTask(const uint8_t task_core, const LedMode led_mode) : Task("Splitflap", 4096, 1, task_core), led_mode_(led_mode), state_semaphore_(xSemaphoreCreateMutex()), profile_semaphore_(xSemaphoreCreateMutex()), alphabet_semaphore_(xSemaphoreCreateMutex()), motion_trace_semaphore_(xSemaphoreCreateMutex()) {
   assert(state_semaphore_ != NULL);
   xSemaphoreGive(state_semaphore_);
+  assert(profile_semaphore_ != NULL);
+  xSemaphoreGive(profile_semaphore_);
+  assert(alphabet_semaphore_ != NULL);
+  xSemaphoreGive(alphabet_semaphore_);
+  assert(motion_trace_semaphore_ != NULL);
+  xSemaphoreGive(motion_trace_semaphore_);
 
   queue_ = xQueueCreate(5, sizeof(Command));
   assert(queue_ != NULL);
+
+  memset(pending_flap_, NO_PENDING_FLAP, sizeof(pending_flap_));
 }
 
 SplitflapTask::~SplitflapTask() {
@@ -43,6 +94,15 @@ SplitflapTask::~SplitflapTask() {
   if (state_semaphore_ != NULL) {
     vSemaphoreDelete(state_semaphore_);
   }
+  if (profile_semaphore_ != NULL) {
+    vSemaphoreDelete(profile_semaphore_);
+  }
+  if (alphabet_semaphore_ != NULL) {
+    vSemaphoreDelete(alphabet_semaphore_);
+  }
+  if (motion_trace_semaphore_ != NULL) {
+    vSemaphoreDelete(motion_trace_semaphore_);
+  }
 }
 
 
@@ -51,6 +111,7 @@ void SplitflapTask::run() {
     ESP_ERROR_CHECK(result);
 
     initialize_modules();
+    loadSettings();
 
     // Initialize shift registers before turning on shift register output-enable
     motor_sensor_io();
@@ -62,14 +123,12 @@ void SplitflapTask::run() {
 
 #if (defined(CHAINLINK) && !defined(CHAINLINK_DRIVER_TESTER))
 #if CHAINLINK_ENFORCE_LOOPBACKS
-    bool loopback_result[NUM_LOOPBACKS][NUM_LOOPBACKS];
-    bool loopback_off_result[NUM_LOOPBACKS];
-    bool loopback_success = chainlink_test_all_loopbacks(loopback_result, loopback_off_result);
+    bool loopback_success = chainlink_test_all_loopbacks(loopback_result_, loopback_off_result_);
 
     if (!loopback_success) {
       for (uint8_t i = 0; i < NUM_LOOPBACKS; i++) {
         for (uint8_t j = 0; j < NUM_LOOPBACKS; j++) {
-          if (!loopback_result[i][j]) {
+          if (!loopback_result_[i][j]) {
             char buffer[200] = {};
             snprintf(buffer, sizeof(buffer), "Loopback ERROR. Set output %u but read incorrect value at input %u", i, j);
             log(buffer);
@@ -77,7 +136,7 @@ void SplitflapTask::run() {
         }
       }
       for (uint8_t j = 0; j < NUM_LOOPBACKS; j++) {
-        if (!loopback_off_result[j]) {
+        if (!loopback_off_result_[j]) {
             char buffer[200] = {};
             snprintf(buffer, sizeof(buffer), "Loopback ERROR. Loopback %u was set when all outputs off - should have been 0", j);
             log(buffer);
@@ -104,25 +163,249 @@ void SplitflapTask::run() {
 #endif
 
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
-        modules[i]->Init();
+        modules.Init(i);
 #if !defined(CHAINLINK_DRIVER_TESTER) && !defined(CHAINLINK_BASE)
-        modules[i]->GoHome();
+        if (!restorePosition(i)) {
+            goHome(i);
+        }
 #endif
     }
 
     while(1) {
+#if LOOP_BENCHMARK
+        uint32_t iteration_start_micros = micros();
+#endif
         processQueue();
         runUpdate();
         result = esp_task_wdt_reset();
         ESP_ERROR_CHECK(result);
+        if (!all_stopped_) {
+            stopped_millis_ = millis();
+            positions_dirty_ = true;
+        } else if (positions_dirty_ && millis() - stopped_millis_ >= POSITION_SAVE_DELAY_MILLIS) {
+            savePositions();
+        }
+        if (all_stopped_ && millis() - last_settings_save_millis_ >= SETTINGS_SAVE_INTERVAL_MILLIS) {
+            saveSettings();
+        }
+#if LOOP_BENCHMARK
+        recordLoopBenchmark(iteration_start_micros);
+#endif
+        waitForNextStep();
+    }
+}
+
+#if LOOP_BENCHMARK
+// Totals up the timing of loop iterations while modules are moving (the loop's busiest), and logs the averages every
+// LOOP_BENCHMARK_INTERVAL_MICROS. "Busy" is the time an iteration takes before it waits for the next step, which limits
+// how fast the loop could run.
+void SplitflapTask::recordLoopBenchmark(uint32_t iteration_start_micros) {
+    uint32_t now = micros();
+    if (all_stopped_) {
+        benchmark_was_moving_ = false;
+        return;
+    }
+    if (benchmark_was_moving_) {
+        benchmark_moving_micros_ += iteration_start_micros - benchmark_last_micros_;
+    }
+    benchmark_was_moving_ = true;
+    benchmark_last_micros_ = iteration_start_micros;
+    benchmark_iterations_++;
+    benchmark_busy_micros_ += now - iteration_start_micros;
+    benchmark_io_micros_ += last_io_micros_;
+
+    if (benchmark_moving_micros_ >= LOOP_BENCHMARK_INTERVAL_MICROS) {
+        uint32_t busy_micros = benchmark_busy_micros_ / benchmark_iterations_;
+        char buf[200];
+        snprintf(buf, sizeof(buf), "Loop: %u modules, %u iterations/s, %u us busy per iteration (%u us SPI IO), up to %u "
+            "iterations/s", NUM_MODULES, (unsigned)((uint64_t)benchmark_iterations_ * 1000000 / benchmark_moving_micros_),
+            (unsigned)busy_micros, (unsigned)(benchmark_io_micros_ / benchmark_iterations_),
+            (unsigned)(1000000 / (busy_micros > 0 ? busy_micros : 1)));
+        log(buf);
+        benchmark_iterations_ = 0;
+        benchmark_moving_micros_ = 0;
+        benchmark_busy_micros_ = 0;
+        benchmark_io_micros_ = 0;
+    }
+}
+#endif
+
+void SplitflapTask::loadSettings() {
+    preferences_.begin(SETTINGS_NAMESPACE);
+
+    // Settings saved with a different number of modules don't line up with the current modules, so ignore them
+    if (preferences_.getBytesLength(SETTINGS_KEY_ACCEL_STEP_BACKOFF) == sizeof(saved_accel_step_backoff_)) {
+        preferences_.getBytes(SETTINGS_KEY_ACCEL_STEP_BACKOFF, saved_accel_step_backoff_, sizeof(saved_accel_step_backoff_));
+        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+            modules.accel_step_backoff[i] = saved_accel_step_backoff_[i];
+        }
+    }
+    if (preferences_.getBytesLength(SETTINGS_KEY_HOME_OFFSET) == sizeof(saved_home_offset_)) {
+        preferences_.getBytes(SETTINGS_KEY_HOME_OFFSET, saved_home_offset_, sizeof(saved_home_offset_));
+        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+            modules.home_offset[i] = saved_home_offset_[i];
+        }
+    }
+    loadAlphabets();
+    loadPositions();
+    last_settings_save_millis_ = millis();
+}
+
+void SplitflapTask::saveSettings() {
+    last_settings_save_millis_ = millis();
+    bool backoff_changed = false;
+    bool home_offset_changed = false;
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        if (saved_accel_step_backoff_[i] != modules.accel_step_backoff[i]) {
+            saved_accel_step_backoff_[i] = modules.accel_step_backoff[i];
+            backoff_changed = true;
+        }
+        if (saved_home_offset_[i] != modules.home_offset[i]) {
+            saved_home_offset_[i] = modules.home_offset[i];
+            home_offset_changed = true;
+        }
+    }
+    if (backoff_changed) {
+        preferences_.putBytes(SETTINGS_KEY_ACCEL_STEP_BACKOFF, saved_accel_step_backoff_, sizeof(saved_accel_step_backoff_));
+    }
+    if (home_offset_changed) {
+        preferences_.putBytes(SETTINGS_KEY_HOME_OFFSET, saved_home_offset_, sizeof(saved_home_offset_));
+    }
+    saveAlphabets();
+    checkStackHighWaterMark();
+}
+
+// Logs a warning when the task comes close to overflowing its stack, each time the unused space reaches a new low.
+// Called after writing settings to flash, which goes deeper into the stack than anything else the task does.
+void SplitflapTask::checkStackHighWaterMark() {
+    uint32_t stack_free = uxTaskGetStackHighWaterMark(NULL);
+    if (stack_free < STACK_FREE_WARNING_BYTES && stack_free < stack_free_logged_) {
+        stack_free_logged_ = stack_free;
+        char buf[80];
+        snprintf(buf, sizeof(buf), "Splitflap task stack nearly full: %u bytes never used", (unsigned)stack_free);
+        log(buf);
+    }
+}
+
+void SplitflapTask::loadAlphabets() {
+    SemaphoreGuard lock(alphabet_semaphore_);
+
+    // As with the other settings, ignore anything saved with a different number of flaps or modules
+    if (preferences_.getBytesLength(SETTINGS_KEY_ALPHABETS) == sizeof(alphabet_codepoints_)) {
+        preferences_.getBytes(SETTINGS_KEY_ALPHABETS, alphabet_codepoints_, sizeof(alphabet_codepoints_));
+        for (uint8_t a = 0; a < MAX_FLAP_ALPHABETS; a++) {
+            alphabets_[a].setCodepoints(alphabet_codepoints_[a]);
+        }
+        alphabets_version_++;
+    }
+    if (preferences_.getBytesLength(SETTINGS_KEY_MODULE_ALPHABET) == sizeof(module_alphabet_)) {
+        preferences_.getBytes(SETTINGS_KEY_MODULE_ALPHABET, module_alphabet_, sizeof(module_alphabet_));
+        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+            if (module_alphabet_[i] >= MAX_FLAP_ALPHABETS) {
+                module_alphabet_[i] = 0;
+            }
+        }
+        alphabets_version_++;
+    }
+}
+
+void SplitflapTask::saveAlphabets() {
+    SemaphoreGuard lock(alphabet_semaphore_);
+    if (!alphabets_changed_) {
+        return;
+    }
+    alphabets_changed_ = false;
+
+    for (uint8_t a = 0; a < MAX_FLAP_ALPHABETS; a++) {
+        memcpy(alphabet_codepoints_[a], alphabets_[a].getCodepoints(), sizeof(alphabet_codepoints_[a]));
+    }
+    preferences_.putBytes(SETTINGS_KEY_ALPHABETS, alphabet_codepoints_, sizeof(alphabet_codepoints_));
+    preferences_.putBytes(SETTINGS_KEY_MODULE_ALPHABET, module_alphabet_, sizeof(module_alphabet_));
+}
+
+void SplitflapTask::loadPositions() {
+    positions_saved_ = preferences_.getBool(SETTINGS_KEY_POSITIONS_SAVED, false);
+    if (!positions_saved_ || preferences_.getBytesLength(SETTINGS_KEY_POSITIONS) != sizeof(saved_positions_)) {
+        positions_saved_ = false;
+        positions_dirty_ = true;
+        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+            saved_positions_[i].step = NO_SAVED_POSITION;
+        }
+        return;
+    }
+    preferences_.getBytes(SETTINGS_KEY_POSITIONS, saved_positions_, sizeof(saved_positions_));
+}
+
+// Saves where every module is stopped, then marks the saved positions as accurate. Modules that aren't homed are saved
+// as needing homing. Only what has changed since the last save is written to flash.
+void SplitflapTask::savePositions() {
+    positions_dirty_ = false;
+    bool changed = false;
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        bool known = modules.state[i] == NORMAL && !modules.IsMoving(i);
+        uint16_t step = known ? modules.GetCurrentStep(i) : NO_SAVED_POSITION;
+        uint8_t flap_index = known ? modules.GetTargetFlapIndex(i) : 0;
+        if (saved_positions_[i].step != step || saved_positions_[i].flap_index != flap_index) {
+            saved_positions_[i].step = step;
+            saved_positions_[i].flap_index = flap_index;
+            changed = true;
+        }
+    }
+    if (changed) {
+        preferences_.putBytes(SETTINGS_KEY_POSITIONS, saved_positions_, sizeof(saved_positions_));
+    }
+    if (!positions_saved_) {
+        preferences_.putBool(SETTINGS_KEY_POSITIONS_SAVED, true);
+        positions_saved_ = true;
+    }
+    checkStackHighWaterMark();
+}
+
+// Clears the marker saying the saved positions are accurate. Must happen before any module takes a step.
+void SplitflapTask::invalidatePositions() {
+    preferences_.putBool(SETTINGS_KEY_POSITIONS_SAVED, false);
+    positions_saved_ = false;
+}
+
+// Puts a module back where it was before the last restart, if its position was saved while it was stopped. Returns
+// false if the module needs homing instead. The module checks the position against its home sensor as it goes, and
+// homes after all if it doesn't match.
+bool SplitflapTask::restorePosition(uint8_t module) {
+    if (!positions_saved_ || saved_positions_[module].step == NO_SAVED_POSITION) {
+        return false;
+    }
+    return modules.RestorePosition(module, saved_positions_[module].step, saved_positions_[module].flap_index);
+}
+
+void SplitflapTask::waitForNextStep() {
+    // Block for as long as possible without missing a step, while still waking up immediately for incoming commands.
+    // FreeRTOS can only block in whole ticks, so if the next step is due within a tick just go around the loop again.
+    TickType_t wait_ticks = MAX_IDLE_WAIT_TICKS;
+    unsigned long next_step_micros;
+    if (modules.GetNextStepMicros(next_step_micros)) {
+        long remaining_micros = (long)(next_step_micros - micros());
+        if (remaining_micros <= 0) {
+            return;
+        }
+        TickType_t remaining_ticks = remaining_micros / (portTICK_PERIOD_MS * 1000);
+        if (remaining_ticks < wait_ticks) {
+            wait_ticks = remaining_ticks;
+        }
+    }
+    if (wait_ticks > 0) {
+        xQueuePeek(queue_, &queue_receive_buffer_, wait_ticks);
     }
 }
 
 void SplitflapTask::processQueue() {
     if (xQueueReceive(queue_, &queue_receive_buffer_, 0) == pdTRUE) {
         switch (queue_receive_buffer_.command_type) {
-            case CommandType::MODULES: {
-                uint8_t* data = queue_receive_buffer_.data.module_command;
+            case CommandType::MODULES:
+            case CommandType::SYNCHRONIZED_MODULES: {
+                bool synchronized = queue_receive_buffer_.command_type == CommandType::SYNCHRONIZED_MODULES;
+                uint8_t* data = synchronized
+                    ? queue_receive_buffer_.data.synchronized_move.module_command
+                    : queue_receive_buffer_.data.module_command;
                 bool any_leds = false;
                 for (uint8_t i = 0; i < NUM_MODULES; i++) {
                     switch (data[i]) {
@@ -130,8 +413,10 @@ void SplitflapTask::processQueue() {
                             // No-op
                             break;
                         case QCMD_RESET_AND_HOME:
-                            modules[i]->ResetState();
-                            modules[i]->GoHome();
+                            clearSequence(i);
+                            clearPendingMove(i);
+                            modules.ResetState(i);
+                            goHome(i);
                             break;
                         case QCMD_LED_ON:
                             any_leds = true;
@@ -146,14 +431,31 @@ void SplitflapTask::processQueue() {
     #endif
                             break;
                         case QCMD_DISABLE:
-                            modules[i]->Disable();
+                            clearSequence(i);
+                            clearPendingMove(i);
+                            modules.Disable(i);
+                            break;
+                        case QCMD_CALIBRATE_HOME:
+                            clearSequence(i);
+                            calibrating_home_offset_[i] = modules.StartHomeOffsetCalibration(i);
+                            if (!calibrating_home_offset_[i]) {
+                                char buf[80];
+                                snprintf(buf, sizeof(buf), "Module %u must be homed before calibrating its home offset", i);
+                                log(buf);
+                            }
                             break;
                         default:
                             assert(data[i] >= QCMD_FLAP && data[i] < QCMD_FLAP + NUM_FLAPS);
-                            modules[i]->GoToFlapIndex(data[i] - QCMD_FLAP);
+                            clearSequence(i);
+                            if (!synchronized) {
+                                goToFlap(i, data[i] - QCMD_FLAP);
+                            }
                             break;
                     }
                 }
+                if (synchronized) {
+                    startSynchronizedMoves(data, queue_receive_buffer_.data.synchronized_move.arrival_spread_millis);
+                }
                 if (any_leds) {
                     motor_sensor_io();
                 }
@@ -161,6 +463,10 @@ void SplitflapTask::processQueue() {
             }
             case CommandType::SENSOR_TEST_SET:
                 sensor_test_ = true;
+                // Modules aren't updated during sensor tests, so nothing would end their holds
+                for (uint8_t i = 0; i < NUM_MODULES; i++) {
+                    modules.ReleaseHold(i);
+                }
                 break;
             case CommandType::SENSOR_TEST_CLEAR:
                 sensor_test_ = false;
@@ -171,25 +477,124 @@ void SplitflapTask::processQueue() {
                     ModuleConfig config = configs.config[i];
 
                     if (config.reset_nonce != current_configs_.config[i].reset_nonce) {
-                        modules[i]->ResetErrorCounters();
-                        modules[i]->GoHome();
+                        clearSequence(i);
+                        modules.ResetErrorCounters(i);
+                        goHome(i);
                     }
 
                     if (config.target_flap_index != current_configs_.config[i].target_flap_index ||
-                            config.target_flap_index != modules[i]->GetTargetFlapIndex() ||
+                            config.target_flap_index != modules.GetTargetFlapIndex(i) ||
                             config.movement_nonce != current_configs_.config[i].movement_nonce) {
                         if (config.target_flap_index >= NUM_FLAPS) {
                             char buffer[200] = {};
                             snprintf(buffer, sizeof(buffer), "Invalid flap index (%u) specified for module %u", config.target_flap_index, i);
                             log(buffer);
                         } else {
-                            modules[i]->GoToFlapIndex(config.target_flap_index);
+                            clearSequence(i);
+                            goToFlap(i, config.target_flap_index);
                         }
                     }
                 }
                 current_configs_ = configs;
                 break;
             }
+            case CommandType::ACCELERATION_PROFILE: {
+                SemaphoreGuard lock(profile_semaphore_);
+                if (pending_profile_length_ == 0) {
+                    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+                        modules.SetAccelerationProfile(i, *Acceleration::DEFAULT_PROFILE);
+                    }
+                    break;
+                }
+
+                // Modules may already be using profile_, but they only read it from this task, so it's safe to
+                // overwrite it in place here.
+                memcpy(accel_step_periods_, pending_accel_step_periods_, pending_profile_length_ * sizeof(uint16_t));
+                memcpy(decel_step_periods_, pending_decel_step_periods_, pending_profile_length_ * sizeof(uint16_t));
+                profile_.accel_step_periods = accel_step_periods_;
+                profile_.decel_step_periods = decel_step_periods_;
+                profile_.max_accel_step = pending_profile_length_ - 1;
+                for (uint8_t i = 0; i < NUM_MODULES; i++) {
+                    modules.SetAccelerationProfile(i, profile_);
+                }
+                break;
+            }
+            case CommandType::SPEED: {
+                uint8_t* speed_percent = queue_receive_buffer_.data.module_speed_percent;
+                for (uint8_t i = 0; i < NUM_MODULES; i++) {
+                    if (speed_percent[i] == 0) {
+                        continue;
+                    }
+                    uint8_t percent = speed_percent[i];
+                    if (percent < MIN_SPEED_PERCENT) {
+                        percent = MIN_SPEED_PERCENT;
+                    } else if (percent > MAX_SPEED_PERCENT) {
+                        percent = MAX_SPEED_PERCENT;
+                    }
+                    modules.SetPeriodScale(i, (uint32_t)modules.PERIOD_SCALE_ONE * 100 / percent);
+                }
+                break;
+            }
+            case CommandType::IDLE_HOLD: {
+                IdleHold* idle_hold = queue_receive_buffer_.data.idle_hold;
+                for (uint8_t i = 0; i < NUM_MODULES; i++) {
+                    if (idle_hold[i].set) {
+                        modules.SetIdleHold(i, idle_hold[i].settle_millis, idle_hold[i].hold_percent, idle_hold[i].hold_millis);
+                    }
+                }
+                break;
+            }
+            case CommandType::MOTION_TRACE: {
+                uint8_t i = queue_receive_buffer_.data.motion_trace_module;
+                if (i >= NUM_MODULES) {
+                    char buffer[100] = {};
+                    snprintf(buffer, sizeof(buffer), "Invalid module (%u) for motion trace", i);
+                    log(buffer);
+                    break;
+                }
+                if (MOTION_TRACE_LENGTH == 0) {
+                    log("Motion traces aren't recorded in this build (see MOTION_TRACE_LENGTH in platformio.ini)");
+                }
+                SemaphoreGuard lock(motion_trace_semaphore_);
+                motion_trace_.module = i;
+                motion_trace_.count = modules.GetMotionTrace(i, motion_trace_.events);
+                motion_trace_.stopped = modules.IsMotionTraceStopped(i);
+                motion_trace_ready_ = true;
+                // Now that someone has seen it, start recording afresh (a stopped trace would otherwise stay stuck on
+                // the first error)
+                modules.RestartMotionTrace(i);
+                break;
+            }
+            case CommandType::SEQUENCE: {
+                SequenceFrame& frame = queue_receive_buffer_.data.sequence_frame;
+                bool overflow = false;
+                for (uint8_t i = 0; i < NUM_MODULES; i++) {
+                    if (frame.clear) {
+                        clearSequence(i);
+                    }
+                    if (frame.flap_index[i] == QSEQ_SKIP) {
+                        continue;
+                    }
+                    if (frame.flap_index[i] >= NUM_FLAPS) {
+                        char buffer[200] = {};
+                        snprintf(buffer, sizeof(buffer), "Invalid flap index (%u) in sequence for module %u", frame.flap_index[i], i);
+                        log(buffer);
+                        continue;
+                    }
+                    if (sequence_count_[i] == MAX_SEQUENCE_STEPS) {
+                        overflow = true;
+                        continue;
+                    }
+                    uint8_t tail = (sequence_head_[i] + sequence_count_[i]) % MAX_SEQUENCE_STEPS;
+                    sequence_steps_[i][tail].flap_index = frame.flap_index[i];
+                    sequence_steps_[i][tail].dwell_millis = frame.dwell_millis;
+                    sequence_count_[i]++;
+                }
+                if (overflow) {
+                    log("Sequence too long; dropped steps for some modules");
+                }
+                break;
+            }
         }
     }
 }
@@ -210,7 +615,7 @@ void SplitflapTask::runUpdate() {
 #ifdef CHAINLINK
       if (led_mode_ == LedMode::AUTO) {
         for (uint8_t i = 0; i < NUM_MODULES; i++) {
-          chainlink_set_led(i, modules[i]->GetHomeState());
+          chainlink_set_led(i, modules.GetHomeState(i));
         }
         // Output LED state
         motor_sensor_io();
@@ -218,39 +623,65 @@ void SplitflapTask::runUpdate() {
 #endif
     } else {
       all_stopped_ = true;
+      advanceSequences();
+      advanceHomeOffsetCalibrations();
+      admitPendingMoves();
+      if (positions_saved_) {
+          for (uint8_t i = 0; i < NUM_MODULES; i++) {
+              if (modules.IsMoving(i)) {
+                  // About to move, so the saved positions won't be accurate much longer
+                  invalidatePositions();
+                  break;
+              }
+          }
+      }
+      // The sensor data is from the transfer started at the end of the previous iteration
+      modules.Update(sensor_sample_micros);
+      memset(moving_count_, 0, sizeof(moving_count_));
       for (uint8_t i = 0; i < NUM_MODULES; i++) {
-        modules[i]->Update();
-        bool is_idle = modules[i]->state == PANIC
-          || modules[i]->state == STATE_DISABLED
-          || modules[i]->state == LOOK_FOR_HOME
-          || modules[i]->state == SENSOR_ERROR
-          || (modules[i]->state == NORMAL && modules[i]->current_accel_step == 0);
+        if (modules.IsMoving(i)) {
+          moving_count_[getPowerChannelForModuleIndex(i)]++;
+        }
 
-        bool is_stopped = modules[i]->state == PANIC
-          || modules[i]->state == STATE_DISABLED
-          || modules[i]->current_accel_step == 0;
+        bool is_idle = modules.state[i] == PANIC
+          || modules.state[i] == STATE_DISABLED
+          || modules.state[i] == LOOK_FOR_HOME
+          || modules.state[i] == SENSOR_ERROR
+          || (modules.state[i] == NORMAL && modules.current_accel_step[i] == 0);
+
+        bool is_stopped = modules.state[i] == PANIC
+          || modules.state[i] == STATE_DISABLED
+          || modules.current_accel_step[i] == 0;
 
 #ifdef CHAINLINK
         if (led_mode_ == LedMode::AUTO) {
-          chainlink_set_led(i, flashGroup < modules[i]->state && flashPhase == 0);
+          chainlink_set_led(i, flashGroup < modules.state[i] && flashPhase == 0);
         }
 #endif
 
         all_idle &= is_idle;
         all_stopped_ &= is_stopped;
       }
-      motor_sensor_io();
+      // Lets the SPI transfer run while the next iteration works out the next steps
+#if LOOP_BENCHMARK
+      uint32_t io_start_micros = micros();
+#endif
+      motor_sensor_io_overlapped();
+#if LOOP_BENCHMARK
+      last_io_micros_ = micros() - io_start_micros;
+#endif
     }
 
 
 #if defined(CHAINLINK) && CHAINLINK_ENFORCE_LOOPBACKS
     // We test loopbacks iteratively, so as not to waste too many cycles/IO-roundtrips all at once. There are
     // two levels of iteration - loopback_step_index_ tracks the small intermediate steps of testing a single
-    // loopback, and loopback_current_out_index_ tracks which loopback we're currently testing.
+    // loopback, and loopback_current_out_index_ tracks which loopback we're currently testing. Validating takes 3
+    // overlapped IO roundtrips after setting the loopback (see chainlink_validate_loopback).
     loopback_step_index_++;
     if (loopback_step_index_ == 1) {
       chainlink_set_loopback(loopback_current_out_index_);
-    } else if (loopback_step_index_ == 3) {
+    } else if (loopback_step_index_ == 4) {
       bool ok = chainlink_validate_loopback(loopback_current_out_index_, nullptr);
       loopback_current_ok_ &= ok;
 
@@ -281,25 +712,248 @@ void SplitflapTask::runUpdate() {
     updateStateCache();
 }
 
-int8_t SplitflapTask::findFlapIndex(uint8_t character) {
-    for (int8_t i = 0; i < NUM_FLAPS; i++) {
-        if (character == flaps[i]) {
-          return i;
+// Starts each module's next queued sequence step once it has finished moving to (and dwelling at) its previous one
+void SplitflapTask::advanceSequences() {
+    uint32_t now = millis();
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        if (sequence_moving_[i]) {
+            if (isBusy(i)) {
+                continue;
+            }
+            sequence_moving_[i] = false;
+            sequence_ready_millis_[i] = now + sequence_dwell_millis_[i];
+        }
+
+        if ((int32_t)(now - sequence_ready_millis_[i]) < 0) {
+            // Still dwelling
+            continue;
+        }
+        if (sequence_count_[i] == 0) {
+            // Keep the ready time current so it can't wrap around while idle
+            sequence_ready_millis_[i] = now;
+            continue;
+        }
+
+        SequenceStep& step = sequence_steps_[i][sequence_head_[i]];
+        sequence_head_[i] = (sequence_head_[i] + 1) % MAX_SEQUENCE_STEPS;
+        sequence_count_[i]--;
+
+        goToFlap(i, step.flap_index);
+        sequence_moving_[i] = true;
+        sequence_dwell_millis_[i] = step.dwell_millis;
+    }
+}
+
+// Keeps modules that are calibrating their home offset turning, one full revolution at a time, and reports the result
+void SplitflapTask::advanceHomeOffsetCalibrations() {
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        if (!calibrating_home_offset_[i]) {
+            continue;
+        }
+        if (modules.IsCalibratingHomeOffset(i) && modules.state[i] == NORMAL) {
+            if (!isBusy(i)) {
+                // Going to the current flap forces a full revolution
+                goToFlap(i, modules.GetTargetFlapIndex(i));
+            }
+            continue;
+        }
+
+        calibrating_home_offset_[i] = false;
+        char buf[80];
+        if (modules.state[i] == NORMAL) {
+            snprintf(buf, sizeof(buf), "Module %u home offset calibrated: %d steps", i, modules.home_offset[i]);
+        } else {
+            snprintf(buf, sizeof(buf), "Module %u home offset calibration stopped; module isn't homed", i);
+        }
+        log(buf);
+    }
+}
+
+// Sends a module to a flap, unless its power channel is already busy (see MAX_MOVING_MODULES_PER_POWER_CHANNEL), in which
+// case it goes once there's room
+void SplitflapTask::goToFlap(uint8_t module, uint8_t flap_index) {
+    if (pending_home_[module] || !canStartMoving(module, false)) {
+        // Still go home first, if that's what it was waiting for
+        pending_flap_[module] = flap_index;
+        holdBack(module);
+        return;
+    }
+    clearPendingMove(module);
+    modules.GoToFlapIndex(module, flap_index);
+}
+
+void SplitflapTask::goHome(uint8_t module) {
+    if (!canStartMoving(module, true)) {
+        pending_home_[module] = true;
+        holdBack(module);
+        return;
+    }
+    // Homing replaces whatever the module was waiting to do
+    clearPendingMove(module);
+    modules.GoHome(module);
+}
+
+// Whether a module is moving or waiting to
+bool SplitflapTask::isBusy(uint8_t module) {
+    return modules.IsMoving(module) || pending_home_[module] || pending_flap_[module] != NO_PENDING_FLAP;
+}
+
+// Whether a module may be sent home (or to a flap) now without going over its power channel's budget, counting it as
+// moving if so. Modules that are already moving can always be sent somewhere else, and modules that the command won't
+// move at all don't use any of the budget: panicked and disabled modules ignore every move, and a module with a sensor
+// error only moves to look for home.
+bool SplitflapTask::canStartMoving(uint8_t module, bool home) {
+    if (MAX_MOVING_MODULES_PER_POWER_CHANNEL == 0 || modules.IsMoving(module)) {
+        return true;
+    }
+    State state = modules.state[module];
+    if (state == PANIC || state == STATE_DISABLED || (state == SENSOR_ERROR && !home)) {
+        return true;
+    }
+    uint8_t& moving = moving_count_[getPowerChannelForModuleIndex(module)];
+    if (moving >= MAX_MOVING_MODULES_PER_POWER_CHANNEL) {
+        return false;
+    }
+    moving++;
+    return true;
+}
+
+// Puts a module in line for its power channel, keeping its place if it's already waiting
+void SplitflapTask::holdBack(uint8_t module) {
+    if (pending_order_[module] != 0) {
+        return;
+    }
+    // 0 means not waiting
+    next_pending_order_++;
+    if (next_pending_order_ == 0) {
+        next_pending_order_++;
+    }
+    pending_order_[module] = next_pending_order_;
+    pending_count_++;
+}
+
+void SplitflapTask::clearPendingMove(uint8_t module) {
+    if (pending_order_[module] == 0) {
+        return;
+    }
+    pending_home_[module] = false;
+    pending_flap_[module] = NO_PENDING_FLAP;
+    pending_order_[module] = 0;
+    pending_count_--;
+}
+
+// Starts held back moves, longest waiting first, while their power channels have room
+void SplitflapTask::admitPendingMoves() {
+    while (pending_count_ > 0) {
+        uint8_t next = NUM_MODULES;
+        for (uint8_t i = 0; i < NUM_MODULES; i++) {
+            if (pending_order_[i] == 0
+                    || moving_count_[getPowerChannelForModuleIndex(i)] >= MAX_MOVING_MODULES_PER_POWER_CHANNEL) {
+                continue;
+            }
+            if (next == NUM_MODULES || (int32_t)(pending_order_[i] - pending_order_[next]) < 0) {
+                next = i;
+            }
+        }
+        if (next == NUM_MODULES) {
+            return;
+        }
+
+        bool home = pending_home_[next];
+        uint8_t flap_index = pending_flap_[next];
+        clearPendingMove(next);
+        if (home) {
+            goHome(next);
+        }
+        if (flap_index != NO_PENDING_FLAP) {
+            goToFlap(next, flap_index);
         }
     }
-    return -1;
+}
+
+void SplitflapTask::clearSequence(uint8_t module) {
+    sequence_head_[module] = 0;
+    sequence_count_[module] = 0;
+    sequence_moving_[module] = false;
+    sequence_ready_millis_[module] = millis();
+}
+
+// Starts modules towards their flaps (the QCMD_FLAP entries of module_command) at staggered times, so that they all
+// arrive within arrival_spread_millis of the last one rather than each arriving as soon as it can. Modules are held back
+// by queueing their move as a sequence step that can't start until their delay is up. Modules that are already moving
+// can't be held back, and modules that can't estimate their travel time (e.g. while looking for home) don't wait for
+// anything, so both of those start right away.
+//
+// The estimates don't account for MAX_MOVING_MODULES_PER_POWER_CHANNEL: a module that's due to start while its channel
+// is full waits its turn (see canStartMoving()) and arrives that much later. So when more modules on a channel move than
+// the channel allows at once, arrival is only synchronized on a best-effort basis, and that's logged.
+void SplitflapTask::startSynchronizedMoves(const uint8_t* module_command, uint16_t arrival_spread_millis) {
+    uint32_t latest_arrival_micros = 0;
+    uint8_t moving_per_channel[NUM_MODULE_POWER_CHANNELS] = {};
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        travel_micros_[i] = 0;
+        if (module_command[i] >= QCMD_FLAP) {
+            travel_micros_[i] = modules.EstimateMicrosToFlapIndex(i, module_command[i] - QCMD_FLAP);
+            if (travel_micros_[i] > latest_arrival_micros) {
+                latest_arrival_micros = travel_micros_[i];
+            }
+        }
+        if (modules.IsMoving(i) || (module_command[i] >= QCMD_FLAP && travel_micros_[i] > 0)) {
+            moving_per_channel[getPowerChannelForModuleIndex(i)]++;
+        }
+    }
+
+    if (MAX_MOVING_MODULES_PER_POWER_CHANNEL > 0) {
+        for (uint8_t c = 0; c < NUM_MODULE_POWER_CHANNELS; c++) {
+            if (moving_per_channel[c] > MAX_MOVING_MODULES_PER_POWER_CHANNEL) {
+                char buffer[120] = {};
+                snprintf(buffer, sizeof(buffer), "Synchronized arrival is best-effort: %u modules to move on power channel %u, which moves at most %u at once",
+                        moving_per_channel[c], c, MAX_MOVING_MODULES_PER_POWER_CHANNEL);
+                log(buffer);
+            }
+        }
+    }
+
+    uint32_t now = millis();
+    for (uint8_t i = 0; i < NUM_MODULES; i++) {
+        if (module_command[i] < QCMD_FLAP) {
+            continue;
+        }
+        uint8_t flap_index = module_command[i] - QCMD_FLAP;
+        uint32_t lead_millis = (latest_arrival_micros - travel_micros_[i]) / 1000;
+        if (travel_micros_[i] == 0 || modules.IsMoving(i) || lead_millis <= arrival_spread_millis) {
+            goToFlap(i, flap_index);
+            continue;
+        }
+        sequence_steps_[i][sequence_head_[i]].flap_index = flap_index;
+        sequence_steps_[i][sequence_head_[i]].dwell_millis = 0;
+        sequence_count_[i] = 1;
+        sequence_ready_millis_[i] = now + lead_millis - arrival_spread_millis;
+    }
 }
 
 void SplitflapTask::updateStateCache() {
     SplitflapState new_state;
     new_state.mode = sensor_test_ ? SplitflapMode::MODE_SENSOR_TEST : SplitflapMode::MODE_RUN;
+    bool update_eta = millis() - last_eta_update_millis_ >= ETA_UPDATE_INTERVAL_MILLIS;
+    if (update_eta) {
+        last_eta_update_millis_ = millis();
+    }
     for (uint8_t i = 0; i < NUM_MODULES; i++) {
-      new_state.modules[i].flap_index = modules[i]->GetCurrentFlapIndex();
-      new_state.modules[i].state = modules[i]->state;
-      new_state.modules[i].moving = modules[i]->current_accel_step > 0;
-      new_state.modules[i].home_state = modules[i]->GetHomeState();
-      new_state.modules[i].count_missed_home = modules[i]->count_missed_home;
-      new_state.modules[i].count_unexpected_home = modules[i]->count_unexpected_home;
+      new_state.modules[i].flap_index = modules.GetCurrentFlapIndex(i);
+      new_state.modules[i].state = modules.state[i];
+      new_state.modules[i].moving = modules.current_accel_step[i] > 0;
+      new_state.modules[i].home_state = modules.GetHomeState(i);
+      new_state.modules[i].count_missed_home = modules.count_missed_home[i];
+      new_state.modules[i].count_unexpected_home = modules.count_unexpected_home[i];
+      new_state.modules[i].max_accel_step = modules.GetMaxAccelStep(i);
+      new_state.modules[i].coil_state = modules.GetCoilState(i);
+      if (update_eta || new_state.modules[i].moving != state_cache_.modules[i].moving) {
+          uint32_t eta_millis = (modules.GetMicrosToArrival(i) + 999) / 1000;
+          new_state.modules[i].eta_millis = eta_millis > 0xFFFF ? 0xFFFF : eta_millis;
+      } else {
+          new_state.modules[i].eta_millis = state_cache_.modules[i].eta_millis;
+      }
     }
 
 #ifdef CHAINLINK
@@ -317,17 +971,32 @@ void SplitflapTask::log(const char* msg) {
     }
 }
 
-void SplitflapTask::showString(const char* str, uint8_t length, bool force_full_rotation) {
+/**
+ * Shows a UTF-8 string on the modules, one character per module, looking each character up in that module's alphabet.
+ * For older clients that send single-byte text, bytes that aren't valid UTF-8 are read as Latin-1 characters (see
+ * decodeUtf8OrLatin1()). Characters that aren't on a module's flaps leave it unchanged. If synchronize_arrival is set,
+ * modules with shorter moves are started later so that every module lands on its flap together (within
+ * arrival_spread_millis), instead of the string rippling into place.
+ */
+void SplitflapTask::showString(const char* str, size_t length, bool force_full_rotation, bool synchronize_arrival, uint16_t arrival_spread_millis) {
     Command command = {};
-    command.command_type = CommandType::MODULES;
-    for (uint8_t i = 0; i < length; i++) {
-        int8_t index = findFlapIndex(str[i]);
-        if (index != -1) {
-            if (force_full_rotation || index != modules[i]->GetTargetFlapIndex()) {
-                command.data.module_command[i] = QCMD_FLAP + index;
+    command.command_type = synchronize_arrival ? CommandType::SYNCHRONIZED_MODULES : CommandType::MODULES;
+    uint8_t* module_command = synchronize_arrival ? command.data.synchronized_move.module_command : command.data.module_command;
+    {
+        SemaphoreGuard lock(alphabet_semaphore_);
+        const char* end = str + length;
+        for (uint8_t i = 0; i < NUM_MODULES && str < end; i++) {
+            uint8_t index = alphabets_[module_alphabet_[i]].findFlapIndex(decodeUtf8OrLatin1(&str, end));
+            if (index != FLAP_ALPHABET_NO_FLAP) {
+                if (force_full_rotation || index != modules.GetTargetFlapIndex(i)) {
+                    module_command[i] = QCMD_FLAP + index;
+                }
             }
         }
     }
+    if (synchronize_arrival) {
+        command.data.synchronized_move.arrival_spread_millis = arrival_spread_millis;
+    }
     assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
 }
 
@@ -376,3 +1045,138 @@ void SplitflapTask::setLogger(Logger* logger) {
 void SplitflapTask::postRawCommand(Command command) {
     assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
 }
+
+/**
+ * Replaces one of the flap alphabets with the characters of a UTF-8 string, which must have exactly one character per
+ * flap, in spool order starting from the home flap. Returns false (and logs why) if the string doesn't match the flaps.
+ * The new alphabet is saved to flash the next time the modules are idle.
+ */
+bool SplitflapTask::setFlapAlphabet(uint8_t alphabet, const char* str, size_t length) {
+    if (alphabet >= MAX_FLAP_ALPHABETS) {
+        char buf[100];
+        snprintf(buf, sizeof(buf), "Invalid flap alphabet %u; only %u alphabets are supported", alphabet, MAX_FLAP_ALPHABETS);
+        log(buf);
+        return false;
+    }
+
+    SemaphoreGuard lock(alphabet_semaphore_);
+    if (!alphabets_[alphabet].setUtf8(str, length)) {
+        char buf[100];
+        snprintf(buf, sizeof(buf), "Invalid flap alphabet %u: must be valid UTF-8 with exactly %u characters", alphabet, NUM_FLAPS);
+        log(buf);
+        return false;
+    }
+    alphabets_changed_ = true;
+    alphabets_version_++;
+    return true;
+}
+
+/**
+ * Sets which flap alphabet each of the first count modules uses. Returns false (and logs why), leaving every module
+ * unchanged, if any of them refers to an alphabet that doesn't exist.
+ */
+bool SplitflapTask::setModuleAlphabets(const uint8_t* module_alphabet, uint8_t count) {
+    count = min((int)count, NUM_MODULES);
+    for (uint8_t i = 0; i < count; i++) {
+        if (module_alphabet[i] >= MAX_FLAP_ALPHABETS) {
+            char buf[100];
+            snprintf(buf, sizeof(buf), "Invalid flap alphabet %u for module %u", module_alphabet[i], i);
+            log(buf);
+            return false;
+        }
+    }
+
+    SemaphoreGuard lock(alphabet_semaphore_);
+    memcpy(module_alphabet_, module_alphabet, count);
+    alphabets_changed_ = true;
+    alphabets_version_++;
+    return true;
+}
+
+/**
+ * Asks for a snapshot of a module's motion trace, which can be collected with takeMotionTrace() once it has been taken.
+ */
+void SplitflapTask::requestMotionTrace(uint8_t module) {
+    Command command = {};
+    command.command_type = CommandType::MOTION_TRACE;
+    command.data.motion_trace_module = module;
+    assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
+}
+
+/**
+ * Copies out the motion trace asked for by requestMotionTrace(), if one has been taken since the last call. Returns
+ * whether there was one.
+ */
+bool SplitflapTask::takeMotionTrace(MotionTrace& out) {
+    SemaphoreGuard lock(motion_trace_semaphore_);
+    if (!motion_trace_ready_) {
+        return false;
+    }
+    out = motion_trace_;
+    motion_trace_ready_ = false;
+    return true;
+}
+
+/**
+ * Writes the UTF-8 character shown on a module's flap into out (which must have room for 4 bytes, plus a terminator)
+ * and returns its length in bytes.
+ */
+uint8_t SplitflapTask::getFlapText(uint8_t module, uint8_t flap_index, char* out) {
+    SemaphoreGuard lock(alphabet_semaphore_);
+    uint8_t length = encodeUtf8(alphabets_[module_alphabet_[module]].getCodepoint(flap_index), out);
+    out[length] = '\0';
+    return length;
+}
+
+/**
+ * Returns a number that changes whenever a flap alphabet, or which alphabet a module uses, changes, so that anything
+ * showing flaps as text (like the TFT display) can tell when to redraw them.
+ */
+uint32_t SplitflapTask::getAlphabetsVersion() {
+    SemaphoreGuard lock(alphabet_semaphore_);
+    return alphabets_version_;
+}
+
+/**
+ * Replaces the acceleration profile used by all modules. decel_step_periods may be null, in which case deceleration
+ * mirrors accel_step_periods. A length of 0 restores the built-in profile. Returns false (and logs why) if the profile
+ * is invalid.
+ */
+bool SplitflapTask::setAccelerationProfile(const uint16_t* accel_step_periods, const uint16_t* decel_step_periods, uint16_t length) {
+    if (length == 1) {
+        log("Invalid acceleration profile: needs at least 2 periods");
+        return false;
+    }
+    if (length > MAX_PROFILE_LENGTH) {
+        char buffer[100] = {};
+        snprintf(buffer, sizeof(buffer), "Invalid acceleration profile: more than %u periods", MAX_PROFILE_LENGTH);
+        log(buffer);
+        return false;
+    }
+    // The idle period times the steps into and out of a move, so a module would take them with no delay at all
+    if (length > 0 && (accel_step_periods[0] == 0 || (decel_step_periods != nullptr && decel_step_periods[0] == 0))) {
+        log("Invalid acceleration profile: idle period (at step 0) is 0");
+        return false;
+    }
+    for (uint16_t i = 1; i < length; i++) {
+        if (accel_step_periods[i] < MIN_PROFILE_STEP_PERIOD_MICROS
+                || (decel_step_periods != nullptr && decel_step_periods[i] < MIN_PROFILE_STEP_PERIOD_MICROS)) {
+            char buffer[200] = {};
+            snprintf(buffer, sizeof(buffer), "Invalid acceleration profile: period at step %u is below %uus", i, MIN_PROFILE_STEP_PERIOD_MICROS);
+            log(buffer);
+            return false;
+        }
+    }
+
+    {
+        SemaphoreGuard lock(profile_semaphore_);
+        pending_profile_length_ = length;
+        memcpy(pending_accel_step_periods_, accel_step_periods, length * sizeof(uint16_t));
+        memcpy(pending_decel_step_periods_, decel_step_periods != nullptr ? decel_step_periods : accel_step_periods, length * sizeof(uint16_t));
+    }
+
+    Command command = {};
+    command.command_type = CommandType::ACCELERATION_PROFILE;
+    assert(xQueueSendToBack(queue_, &command, portMAX_DELAY) == pdTRUE);
+    return true;
+}
@@ -15,7 +15,10 @@
 */
 #pragma once
 
+#include <Preferences.h>
+
 #include "config.h"
+#include "flap_alphabet.h"
 #include "logger.h"
 #include "src/splitflap_module_data.h"
 
@@ -33,6 +36,10 @@ struct SplitflapModuleState {
     bool home_state;
     uint8_t count_unexpected_home;
     uint8_t count_missed_home;
+    uint16_t max_accel_step;
+    // Estimated time until the module arrives at its target flap, or 0 if it isn't moving or doesn't know yet
+    uint16_t eta_millis;
+    CoilState coil_state;
 
     bool operator==(const SplitflapModuleState& other) {
         return state == other.state
@@ -40,7 +47,10 @@ struct SplitflapModuleState {
             && moving == other.moving
             && home_state == other.home_state
             && count_unexpected_home == other.count_unexpected_home
-            && count_missed_home == other.count_missed_home;
+            && count_missed_home == other.count_missed_home
+            && max_accel_step == other.max_accel_step
+            && eta_millis == other.eta_millis
+            && coil_state == other.coil_state;
     }
 
     bool operator!=(const SplitflapModuleState& other) {
@@ -85,6 +95,12 @@ enum class CommandType {
     SENSOR_TEST_SET,
     SENSOR_TEST_CLEAR,
     CONFIG,
+    ACCELERATION_PROFILE,
+    SPEED,
+    SEQUENCE,
+    SYNCHRONIZED_MODULES,
+    IDLE_HOLD,
+    MOTION_TRACE,
 };
 
 struct ModuleConfig {
@@ -97,21 +113,114 @@ struct ModuleConfigs {
     ModuleConfig config[NUM_MODULES];
 };
 
+// One step of a sequence for every module: each module goes to its flap_index, waits dwell_millis after arriving, then
+// moves on to the next step queued for it.
+struct SequenceFrame {
+    // Flap index for each module, or QSEQ_SKIP to not queue a step for that module
+    uint8_t flap_index[NUM_MODULES];
+    uint16_t dwell_millis;
+    // Whether to clear every module's queued steps before adding this frame's steps
+    bool clear;
+};
+
+struct SequenceStep {
+    uint8_t flap_index;
+    uint16_t dwell_millis;
+};
+
+// Like CommandType::MODULES, but modules are started at staggered times so they all arrive at their flaps together
+struct SynchronizedMove {
+    uint8_t module_command[NUM_MODULES];
+    // How far apart arrivals are allowed to be. Modules that would arrive within this window of the last module don't
+    // get held back.
+    uint16_t arrival_spread_millis;
+};
+
+// What a module does with its coils after each move (see SplitflapModuleBank::SetIdleHold)
+struct IdleHold {
+    uint16_t settle_millis;
+    uint16_t hold_millis;
+    uint8_t hold_percent;
+    // Whether to change this module's policy at all
+    bool set;
+};
+
 struct Command {
     CommandType command_type;
     union CommandData {
         uint8_t module_command[NUM_MODULES];
         ModuleConfigs module_configs;
+        // Percent of normal speed for each module; 0 leaves the module unchanged
+        uint8_t module_speed_percent[NUM_MODULES];
+        SequenceFrame sequence_frame;
+        SynchronizedMove synchronized_move;
+        IdleHold idle_hold[NUM_MODULES];
+        uint8_t motion_trace_module;
     };
     CommandData data;
 };
 
+// One module's recent step events (see SplitflapModuleBank::GetMotionTrace), oldest first
+struct MotionTrace {
+    uint8_t module;
+    uint8_t count;
+    // Whether recording had stopped after an error, so the events lead up to it
+    bool stopped;
+    MotionTraceEvent events[MOTION_TRACE_LENGTH > 0 ? MOTION_TRACE_LENGTH : 1];
+};
+
 #define QCMD_NO_OP          0
 #define QCMD_RESET_AND_HOME 1
 #define QCMD_LED_ON         2
 #define QCMD_LED_OFF        3
 #define QCMD_DISABLE        4
-#define QCMD_FLAP           5
+#define QCMD_CALIBRATE_HOME 5
+#define QCMD_FLAP           6
+
+#define QSEQ_SKIP           0xFF
+
+// Where a module was stopped, as saved to flash so that it can carry on from there after a restart
+struct SavedPosition {
+    // Step within the gearbox cycle (see SplitflapModuleBank::GetCurrentStep), or NO_SAVED_POSITION if the module
+    // needs homing
+    uint16_t step;
+    uint8_t flap_index;
+};
+
+#define NO_SAVED_POSITION 0xFFFF
+
+// Number of sequence steps that can be queued per module
+#define MAX_SEQUENCE_STEPS 8
+
+// Number of flap alphabets that modules can choose between
+#define MAX_FLAP_ALPHABETS 4
+
+// Modules are powered in groups (e.g. by the power channels of a Chainlink Base). See getPowerChannelForModuleIndex().
+#define MODULES_PER_POWER_CHANNEL 36
+#define NUM_MODULE_POWER_CHANNELS ((NUM_MODULES + MODULES_PER_POWER_CHANNEL - 1) / MODULES_PER_POWER_CHANNEL)
+
+// Most modules on one power channel that may be moving (or homing) at once, so that the channel's supply isn't asked for
+// more current than it can give. Moves beyond that wait, in the order they were requested, for others to finish. 0
+// means no limit.
+#ifndef MAX_MOVING_MODULES_PER_POWER_CHANNEL
+#define MAX_MOVING_MODULES_PER_POWER_CHANNEL 0
+#endif
+
+#define NO_PENDING_FLAP     0xFF
+
+// Range of module speeds accepted by CommandType::SPEED, in percent
+#define MIN_SPEED_PERCENT 10
+#define MAX_SPEED_PERCENT 200
+
+// Fastest step period accepted in an uploaded acceleration profile, well beyond what the motors can actually follow
+#if HALF_STEP
+#define MIN_PROFILE_STEP_PERIOD_MICROS 400
+#else
+#define MIN_PROFILE_STEP_PERIOD_MICROS 800
+#endif
+
+// Most periods an uploaded acceleration profile can have (see AccelerationProfile in splitflap.proto)
+#define MAX_PROFILE_LENGTH 320
 
 class SplitflapTask : public Task<SplitflapTask> {
     friend class Task<SplitflapTask>; // Allow base Task to invoke protected run()
@@ -122,13 +231,23 @@ class SplitflapTask : public Task<SplitflapTask> {
         
         SplitflapState getState();
 
-        void showString(const char *str, uint8_t length, bool force_full_rotation = FORCE_FULL_ROTATION);
+        void showString(const char *str, size_t length, bool force_full_rotation = FORCE_FULL_ROTATION,
+                bool synchronize_arrival = false, uint16_t arrival_spread_millis = 0);
         void resetAll();
         void disableAll();
         void setLed(uint8_t id, bool on);
         void setSensorTest(bool sensor_test);
         void setLogger(Logger* logger);
         void postRawCommand(Command command);
+        bool setAccelerationProfile(const uint16_t* accel_step_periods, const uint16_t* decel_step_periods, uint16_t length);
+        bool setFlapAlphabet(uint8_t alphabet, const char* str, size_t length);
+        bool setModuleAlphabets(const uint8_t* module_alphabet, uint8_t count);
+        uint8_t getFlapText(uint8_t module, uint8_t flap_index, char* out);
+        uint32_t getAlphabetsVersion();
+        void requestMotionTrace(uint8_t module);
+        bool takeMotionTrace(MotionTrace& out);
+
+        static uint8_t getPowerChannelForModuleIndex(uint8_t module_index);
 
     protected:
         void run();
@@ -146,21 +265,134 @@ class SplitflapTask : public Task<SplitflapTask> {
         bool sensor_test_ = SENSOR_TEST;
         ModuleConfigs current_configs_ = {};
 
+        // Acceleration profile uploaded at runtime. The pending profile is written by setAccelerationProfile() from
+        // other tasks (protected by profile_semaphore_), and copied into the active profile (only touched by this
+        // task) when the corresponding ACCELERATION_PROFILE command is processed.
+        const SemaphoreHandle_t profile_semaphore_;
+        uint16_t pending_profile_length_ = 0;
+        uint16_t pending_accel_step_periods_[MAX_PROFILE_LENGTH] = {};
+        uint16_t pending_decel_step_periods_[MAX_PROFILE_LENGTH] = {};
+        uint16_t accel_step_periods_[MAX_PROFILE_LENGTH] = {};
+        uint16_t decel_step_periods_[MAX_PROFILE_LENGTH] = {};
+        Acceleration::Profile profile_ = {};
+
+        // Settings persisted to flash (NVS). Only written while all modules are stopped, since writing to flash
+        // stalls the CPU.
+        Preferences preferences_;
+        uint16_t saved_accel_step_backoff_[NUM_MODULES] = {};
+        int8_t saved_home_offset_[NUM_MODULES] = {};
+        uint32_t last_settings_save_millis_ = 0;
+
+        // Module positions saved to flash once everything has stopped, so that a restart can pick up where the modules
+        // were left instead of homing them. positions_saved_ mirrors a marker in flash saying the saved positions are
+        // still accurate, which is cleared before any module moves again: if power is lost mid-move, the modules home
+        // as usual on the next boot. positions_dirty_ marks that modules have moved since the positions were last saved.
+        SavedPosition saved_positions_[NUM_MODULES] = {};
+        bool positions_saved_ = false;
+        bool positions_dirty_ = false;
+        uint32_t stopped_millis_ = 0;
+
+        // Flap alphabets, and which one each module uses to map characters to flaps. Used from other tasks (e.g. by
+        // showString()), so protected by alphabet_semaphore_. alphabets_changed_ marks them as needing to be saved.
+        const SemaphoreHandle_t alphabet_semaphore_;
+        FlapAlphabet alphabets_[MAX_FLAP_ALPHABETS];
+        uint8_t module_alphabet_[NUM_MODULES] = {};
+        bool alphabets_changed_ = false;
+        // Incremented whenever the alphabets or module_alphabet_ change (see getAlphabetsVersion())
+        uint32_t alphabets_version_ = 0;
+        // Scratch space for loadAlphabets() and saveAlphabets(), which store every alphabet as one blob
+        uint32_t alphabet_codepoints_[MAX_FLAP_ALPHABETS][NUM_FLAPS] = {};
+
+        // Per-module FIFO of queued sequence steps, drained by advanceSequences()
+        SequenceStep sequence_steps_[NUM_MODULES][MAX_SEQUENCE_STEPS] = {};
+        uint8_t sequence_head_[NUM_MODULES] = {};
+        uint8_t sequence_count_[NUM_MODULES] = {};
+        // Whether the module is moving to a sequence step, and how long to dwell once it gets there
+        bool sequence_moving_[NUM_MODULES] = {};
+        uint16_t sequence_dwell_millis_[NUM_MODULES] = {};
+        // When the module may start its next sequence step
+        uint32_t sequence_ready_millis_[NUM_MODULES] = {};
+
+        // Modules measuring their home offset, which advanceHomeOffsetCalibrations() keeps turning until they're done
+        bool calibrating_home_offset_[NUM_MODULES] = {};
+
+        // Moves held back by MAX_MOVING_MODULES_PER_POWER_CHANNEL: whether each module is waiting to home and/or the flap
+        // it's waiting to go to, and when it started waiting (as a count of held back moves, for first come first served)
+        bool pending_home_[NUM_MODULES] = {};
+        uint8_t pending_flap_[NUM_MODULES] = {};
+        uint32_t pending_order_[NUM_MODULES] = {};
+        uint32_t next_pending_order_ = 0;
+        uint8_t pending_count_ = 0;
+        // Modules moving on each power channel, as of the last update plus any started since
+        uint8_t moving_count_[NUM_MODULE_POWER_CHANNELS] = {};
+
+        // Latest motion trace requested with requestMotionTrace(), waiting to be picked up by takeMotionTrace(). Protected
+        // by motion_trace_semaphore_.
+        const SemaphoreHandle_t motion_trace_semaphore_;
+        MotionTrace motion_trace_ = {};
+        bool motion_trace_ready_ = false;
+
+        // Scratch space for startSynchronizedMoves()
+        uint32_t travel_micros_[NUM_MODULES] = {};
+
+#if LOOP_BENCHMARK
+        // Loop timings totalled over iterations while modules are moving, logged by recordLoopBenchmark()
+        uint32_t benchmark_iterations_ = 0;
+        uint32_t benchmark_moving_micros_ = 0;
+        uint32_t benchmark_busy_micros_ = 0;
+        uint32_t benchmark_io_micros_ = 0;
+        uint32_t benchmark_last_micros_ = 0;
+        bool benchmark_was_moving_ = false;
+        // Time spent in the SPI transfer by the last runUpdate()
+        uint32_t last_io_micros_ = 0;
+        void recordLoopBenchmark(uint32_t iteration_start_micros);
+#endif
+
 #ifdef CHAINLINK
         uint8_t loopback_current_out_index_ = 0;
         uint16_t loopback_step_index_ = 0;
         bool loopback_current_ok_ = true;
         bool loopback_all_ok_ = false;
+#if CHAINLINK_ENFORCE_LOOPBACKS
+        // Scratch space for the loopback test in run()
+        bool loopback_result_[NUM_LOOPBACKS][NUM_LOOPBACKS] = {};
+        bool loopback_off_result_[NUM_LOOPBACKS] = {};
+#endif
 #endif
 
+        // Least free stack space logged so far by checkStackHighWaterMark()
+        uint32_t stack_free_logged_ = UINT32_MAX;
+        void checkStackHighWaterMark();
+
         // Cached state. Protected by state_semaphore_
         SplitflapState state_cache_;
+        uint32_t last_eta_update_millis_ = 0;
         void updateStateCache();
 
         void processQueue();
         void runUpdate();
+        void waitForNextStep();
+        void loadSettings();
+        void saveSettings();
+        void advanceSequences();
+        void clearSequence(uint8_t module);
+        void advanceHomeOffsetCalibrations();
+        void startSynchronizedMoves(const uint8_t* module_command, uint16_t arrival_spread_millis);
+        void goToFlap(uint8_t module, uint8_t flap_index);
+        void goHome(uint8_t module);
+        bool isBusy(uint8_t module);
+        bool canStartMoving(uint8_t module, bool home);
+        void holdBack(uint8_t module);
+        void clearPendingMove(uint8_t module);
+        void admitPendingMoves();
         void sensorTestUpdate();
         void log(const char* msg);
 
-        int8_t findFlapIndex(uint8_t character);
+        void loadAlphabets();
+        void saveAlphabets();
+
+        void loadPositions();
+        void savePositions();
+        void invalidatePositions();
+        bool restorePosition(uint8_t module);
 };
@@ -27,6 +27,9 @@ PB_BIND(PB_SupervisorState_PowerChannelState, PB_SupervisorState_PowerChannelSta
 PB_BIND(PB_SupervisorState_FaultInfo, PB_SupervisorState_FaultInfo, 2)
 
 
+PB_BIND(PB_MotionTrace, PB_MotionTrace, 2)
+
+
 PB_BIND(PB_FromSplitflap, PB_FromSplitflap, 4)
 
 
@@ -45,7 +48,32 @@ PB_BIND(PB_SplitflapConfig_ModuleConfig, PB_SplitflapConfig_ModuleConfig, AUTO)
 PB_BIND(PB_RequestState, PB_RequestState, AUTO)
 
 
-PB_BIND(PB_ToSplitflap, PB_ToSplitflap, 2)
+PB_BIND(PB_RequestMotionTrace, PB_RequestMotionTrace, AUTO)
+
+
+PB_BIND(PB_AccelerationProfile, PB_AccelerationProfile, 2)
+
+
+PB_BIND(PB_MotionConfig, PB_MotionConfig, 2)
+
+
+PB_BIND(PB_MotionConfig_IdleHold, PB_MotionConfig_IdleHold, AUTO)
+
+
+PB_BIND(PB_SplitflapSequence, PB_SplitflapSequence, 2)
+
+
+PB_BIND(PB_SplitflapSequence_Frame, PB_SplitflapSequence_Frame, 2)
+
+
+PB_BIND(PB_FlapAlphabetConfig, PB_FlapAlphabetConfig, 2)
+
+
+PB_BIND(PB_FlapAlphabetConfig_Alphabet, PB_FlapAlphabetConfig_Alphabet, 2)
+
+
+PB_BIND(PB_ToSplitflap, PB_ToSplitflap, 4)
+
 
 
 
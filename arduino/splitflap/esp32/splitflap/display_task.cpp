@@ -67,14 +67,19 @@ void DisplayTask::run() {
     uint8_t module_row, module_col;
     int32_t module_x, module_y;
     SplitflapState last_state = {};
+    uint32_t last_alphabets_version = 0;
+    bool first_draw = true;
     String last_messages[countof(messages_)] = {};
     while(1) {
         SplitflapState state = splitflap_task_.getState();
-        if (state != last_state) {
+        // A changed flap alphabet changes what every module shows, even though none of them has moved
+        uint32_t alphabets_version = splitflap_task_.getAlphabetsVersion();
+        bool redraw_all = first_draw || alphabets_version != last_alphabets_version;
+        if (redraw_all || state != last_state) {
             tft_.setTextSize(module_text_size);
             for (uint8_t i = 0; i < NUM_MODULES; i++) {
                 SplitflapModuleState& s = state.modules[i];
-                if (s == last_state.modules[i]) {
+                if (!redraw_all && s == last_state.modules[i]) {
                     continue;
                 }
 
@@ -83,50 +88,54 @@ void DisplayTask::run() {
 
                 bool blink = (millis() / 400) % 2;
 
-                char c;
+                // Flaps are drawn from the module's flap alphabet, as UTF-8. Characters the font doesn't have are left
+                // blank.
+                char flap_text[5];
+                const char* text;
                 switch (s.state) {
                     case NORMAL:
-                        c = flaps[s.flap_index];
+                        splitflap_task_.getFlapText(i, s.flap_index, flap_text);
+                        text = flap_text;
                         if (s.moving) {
                             // use a dimmer color when moving
                             foreground = 0x6b4d;
                         }
 
                         // You can add special-case color handling here if desired:
-                        // if (c == 'w') {
-                        //     c = ' ';
+                        // if (strcmp(text, "w") == 0) {
+                        //     text = " ";
                         //     background = 0xFFFF;
-                        // } else if (c == 'y') {
-                        //     c = ' ';
+                        // } else if (strcmp(text, "y") == 0) {
+                        //     text = " ";
                         //     background = 0xffe0;
-                        // } else if (c == 'o') {
-                        //     c = ' ';
+                        // } else if (strcmp(text, "o") == 0) {
+                        //     text = " ";
                         //     background = 0xfd00;
-                        // } else if (c == 'g') {
-                        //     c = ' ';
+                        // } else if (strcmp(text, "g") == 0) {
+                        //     text = " ";
                         //     background = 0x46a0;
-                        // } else if (c == 'p') {
-                        //     c = ' ';
+                        // } else if (strcmp(text, "p") == 0) {
+                        //     text = " ";
                         //     background = 0xd938;
                         // }
                         break;
                     case PANIC:
-                        c = '~';
+                        text = "~";
                         background = blink ? 0xD000 : 0;
                         break;
                     case STATE_DISABLED:
-                        c = '*';
+                        text = "*";
                         break;
                     case LOOK_FOR_HOME:
-                        c = '?';
+                        text = "?";
                         background = blink ? 0x6018 : 0;
                         break;
                     case SENSOR_ERROR:
-                        c = ' ';
+                        text = " ";
                         background = blink ? 0xD461 : 0;
                         break;
                     default:
-                        c = ' ';
+                        text = " ";
                         break;
                 }
                 getLayoutPosition(i, &module_row, &module_col);
@@ -138,9 +147,11 @@ void DisplayTask::run() {
                 tft_.setTextColor(foreground, background);
                 tft_.fillRect(module_x, module_y, module_width, module_height, background);
                 tft_.setCursor(module_x + 1, module_y + 2);
-                tft_.printf("%c", c);
+                tft_.print(text);
             }
             last_state = state;
+            last_alphabets_version = alphabets_version;
+            first_draw = false;
         }
 
         const int message_height = 10;
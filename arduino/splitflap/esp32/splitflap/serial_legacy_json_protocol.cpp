@@ -148,12 +148,31 @@ void SerialLegacyJsonProtocol::dumpStatus(const SplitflapState& state) {
                 break;
         }
         stream_.print("\", \"flap\":\"");
-        stream_.write(flaps[state.modules[i].flap_index]);
+        char flap_text[5];
+        splitflap_task_.getFlapText(i, state.modules[i].flap_index, flap_text);
+        stream_.print(flap_text);
         stream_.print("\", \"count_missed_home\":");
         stream_.print(state.modules[i].count_missed_home);
         stream_.print(", \"count_unexpected_home\":");
         stream_.print(state.modules[i].count_unexpected_home);
-        stream_.print("}");
+        stream_.print(", \"eta_millis\":");
+        stream_.print(state.modules[i].eta_millis);
+        stream_.print(", \"coils\":\"");
+        switch (state.modules[i].coil_state) {
+            case COIL_OFF:
+                stream_.print("off");
+                break;
+            case COIL_STEPPING:
+                stream_.print("stepping");
+                break;
+            case COIL_SETTLING:
+                stream_.print("settling");
+                break;
+            case COIL_PULSED_HOLD:
+                stream_.print("pulsed_hold");
+                break;
+        }
+        stream_.print("\"}");
         if (i < NUM_MODULES - 1) {
             stream_.print(", ");
         }
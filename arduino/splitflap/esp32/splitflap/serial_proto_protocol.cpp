@@ -26,6 +26,11 @@ static SerialProtoProtocol* singleton_for_packet_serial = 0;
 static const uint16_t MIN_STATE_INTERVAL_MILLIS = 250;
 static const uint16_t PERIODIC_STATE_INTERVAL_MILLIS = 5000;
 
+static_assert(MOTION_TRACE_LENGTH <= sizeof(PB_MotionTrace::events) / sizeof(PB_MotionTrace::events[0]),
+        "MOTION_TRACE_LENGTH is too long for the MotionTrace message");
+static_assert(sizeof(PB_AccelerationProfile::accel_step_periods) / sizeof(PB_AccelerationProfile::accel_step_periods[0]) <= MAX_PROFILE_LENGTH,
+        "AccelerationProfile allows more periods than the splitflap task can hold");
+
 SerialProtoProtocol::SerialProtoProtocol(SplitflapTask& splitflap_task, Stream& stream) :
         SerialProtocol(splitflap_task),
         stream_(stream) {
@@ -91,6 +96,9 @@ void SerialProtoProtocol::loop() {
                 .home_state = latest_state_.modules[i].home_state,
                 .count_unexpected_home = latest_state_.modules[i].count_unexpected_home,
                 .count_missed_home = latest_state_.modules[i].count_missed_home,
+                .max_accel_step = latest_state_.modules[i].max_accel_step,
+                .eta_millis = latest_state_.modules[i].eta_millis,
+                .coils = (PB_SplitflapState_ModuleState_Coils) latest_state_.modules[i].coil_state,
             };
         }
 
@@ -99,6 +107,19 @@ void SerialProtoProtocol::loop() {
         last_sent_state_ = latest_state_;
         last_sent_state_millis_ = millis();
     }
+
+    if (splitflap_task_.takeMotionTrace(motion_trace_)) {
+        pb_tx_buffer_ = {};
+        pb_tx_buffer_.which_payload = PB_FromSplitflap_motion_trace_tag;
+        PB_MotionTrace& trace = pb_tx_buffer_.payload.motion_trace;
+        trace.module = motion_trace_.module;
+        trace.events_count = motion_trace_.count;
+        for (uint8_t e = 0; e < motion_trace_.count; e++) {
+            trace.events[e] = ((uint32_t)motion_trace_.events[e].step << 16) | motion_trace_.events[e].data;
+        }
+        trace.stopped = motion_trace_.stopped;
+        sendPbTxBuffer();
+    }
 }
 
 void SerialProtoProtocol::handlePacket(const uint8_t* buffer, size_t size) {
@@ -147,18 +168,25 @@ void SerialProtoProtocol::handlePacket(const uint8_t* buffer, size_t size) {
         case PB_ToSplitflap_splitflap_command_tag: {
             PB_SplitflapCommand command = pb_rx_buffer_.payload.splitflap_command;
             Command c = {};
-            c.command_type = CommandType::MODULES;
+            c.command_type = command.synchronize_arrival ? CommandType::SYNCHRONIZED_MODULES : CommandType::MODULES;
+            uint8_t* module_command = command.synchronize_arrival ? c.data.synchronized_move.module_command : c.data.module_command;
+            if (command.synchronize_arrival) {
+                c.data.synchronized_move.arrival_spread_millis = command.arrival_spread_millis;
+            }
             for (uint8_t i = 0; i < min((int)command.modules_count, NUM_MODULES); i++) {
                 switch (command.modules[i].action) {
                     case PB_SplitflapCommand_ModuleCommand_Action_NO_OP:
-                        c.data.module_command[i] = QCMD_NO_OP;
+                        module_command[i] = QCMD_NO_OP;
                         break;
                     case PB_SplitflapCommand_ModuleCommand_Action_RESET_AND_HOME:
-                        c.data.module_command[i] = QCMD_RESET_AND_HOME;
+                        module_command[i] = QCMD_RESET_AND_HOME;
+                        break;
+                    case PB_SplitflapCommand_ModuleCommand_Action_CALIBRATE_HOME_OFFSET:
+                        module_command[i] = QCMD_CALIBRATE_HOME;
                         break;
                     case PB_SplitflapCommand_ModuleCommand_Action_GO_TO_FLAP:
                         if (command.modules[i].param <= 255 - QCMD_FLAP) {
-                            c.data.module_command[i] = QCMD_FLAP + command.modules[i].param;
+                            module_command[i] = QCMD_FLAP + command.modules[i].param;
                         }
                         break;
                     default:
@@ -185,6 +213,74 @@ void SerialProtoProtocol::handlePacket(const uint8_t* buffer, size_t size) {
         case PB_ToSplitflap_request_state_tag:
             state_requested_ = true;
             break;
+        case PB_ToSplitflap_request_motion_trace_tag:
+            splitflap_task_.requestMotionTrace(pb_rx_buffer_.payload.request_motion_trace.module);
+            break;
+        case PB_ToSplitflap_motion_config_tag: {
+            PB_MotionConfig& motion_config = pb_rx_buffer_.payload.motion_config;
+            if (motion_config.has_acceleration_profile) {
+                PB_AccelerationProfile& profile = motion_config.acceleration_profile;
+                if (profile.decel_step_periods_count != 0 && profile.decel_step_periods_count != profile.accel_step_periods_count) {
+                    log("Invalid acceleration profile: accel and decel periods must be the same length");
+                } else {
+                    splitflap_task_.setAccelerationProfile(
+                        profile.accel_step_periods,
+                        profile.decel_step_periods_count != 0 ? profile.decel_step_periods : nullptr,
+                        profile.accel_step_periods_count);
+                }
+            }
+            if (motion_config.module_speed_percent_count > 0) {
+                Command c = {};
+                c.command_type = CommandType::SPEED;
+                for (uint8_t i = 0; i < min((int)motion_config.module_speed_percent_count, NUM_MODULES); i++) {
+                    c.data.module_speed_percent[i] = motion_config.module_speed_percent[i];
+                }
+                splitflap_task_.postRawCommand(c);
+            }
+            if (motion_config.module_idle_hold_count > 0) {
+                Command c = {};
+                c.command_type = CommandType::IDLE_HOLD;
+                for (uint8_t i = 0; i < min((int)motion_config.module_idle_hold_count, NUM_MODULES); i++) {
+                    PB_MotionConfig_IdleHold& idle_hold = motion_config.module_idle_hold[i];
+                    c.data.idle_hold[i] = {
+                        .settle_millis = idle_hold.settle_millis,
+                        .hold_millis = idle_hold.hold_millis,
+                        .hold_percent = idle_hold.hold_percent,
+                        .set = true,
+                    };
+                }
+                splitflap_task_.postRawCommand(c);
+            }
+            break;
+        }
+        case PB_ToSplitflap_splitflap_sequence_tag: {
+            PB_SplitflapSequence& sequence = pb_rx_buffer_.payload.splitflap_sequence;
+            // An empty sequence still gets sent (as a single empty frame) so that it clears any queued frames
+            for (uint8_t f = 0; f < max((int)sequence.frames_count, 1); f++) {
+                PB_SplitflapSequence_Frame* frame = f < sequence.frames_count ? &sequence.frames[f] : nullptr;
+                Command c = {};
+                c.command_type = CommandType::SEQUENCE;
+                c.data.sequence_frame.dwell_millis = frame != nullptr ? frame->dwell_millis : 0;
+                c.data.sequence_frame.clear = f == 0 && !sequence.append;
+                for (uint8_t i = 0; i < NUM_MODULES; i++) {
+                    bool has_flap = frame != nullptr && i < frame->flap_index_count;
+                    c.data.sequence_frame.flap_index[i] = has_flap ? frame->flap_index[i] : QSEQ_SKIP;
+                }
+                splitflap_task_.postRawCommand(c);
+            }
+            break;
+        }
+        case PB_ToSplitflap_flap_alphabet_config_tag: {
+            PB_FlapAlphabetConfig& alphabet_config = pb_rx_buffer_.payload.flap_alphabet_config;
+            for (uint8_t a = 0; a < alphabet_config.alphabets_count; a++) {
+                const char* flaps = alphabet_config.alphabets[a].flaps;
+                splitflap_task_.setFlapAlphabet(a, flaps, strlen(flaps));
+            }
+            if (alphabet_config.module_alphabet_count > 0) {
+                splitflap_task_.setModuleAlphabets(alphabet_config.module_alphabet, alphabet_config.module_alphabet_count);
+            }
+            break;
+        }
         default: {
             char buf[200];
             snprintf(buf, sizeof(buf), "Unknown ToSplitflap type: %d", pb_rx_buffer_.which_payload);
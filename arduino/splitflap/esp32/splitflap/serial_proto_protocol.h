@@ -48,6 +48,9 @@ class SerialProtoProtocol : public SerialProtocol {
 
         bool state_requested_;
 
+        // Scratch space for motion traces on their way out
+        MotionTrace motion_trace_ = {};
+
         void sendPbTxBuffer();
         void handlePacket(const uint8_t* buffer, size_t size);
         void ack(uint32_t nonce);
@@ -0,0 +1,252 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+// Measures the cost of SplitflapModuleBank::Update() on the host for a range of module counts and module states.
+//
+// Modules are wired to motor/sensor buffers the same way spi_io_config.h wires them to the shift register chain, and
+// a trivial spool model turns motor steps back into home sensor pulses so that modules home and run exactly as they
+// would on real hardware. Only the Update() passes are timed; the spool model runs between passes.
+//
+// Usage: module_update_benchmark [passes]
+
+#include <Arduino.h>
+
+#include <chrono>
+#include <memory>
+#include <stdlib.h>
+
+#include "src/splitflap_module.h"
+
+typedef ModuleGeometry<DefaultModuleTraits> Geometry;
+
+// GEAR_RATIO_INPUT_STEPS covers GEAR_RATIO_OUTPUT full revolutions of the spool
+static const uint32_t STEPS_PER_SPOOL_REVOLUTION = Geometry::GEAR_RATIO_INPUT_STEPS / DefaultModuleTraits::GEAR_RATIO_OUTPUT;
+static const uint32_t HOME_SENSOR_WIDTH_STEPS = Geometry::ROUGH_STEPS_PER_FLAP / 2;
+
+// Simulated time between passes. This is longer than any acceleration period, so every module is due on every pass,
+// which is the worst case the firmware main loop has to keep up with.
+static const unsigned long PASS_INTERVAL_MICROS = 10000;
+
+static const uint32_t WARMUP_PASSES = 1000;
+static const uint32_t MAX_HOMING_PASSES = 20000;
+
+enum class Scenario {
+    MOVING,
+    LOOK_FOR_HOME,
+    IDLE,
+};
+
+static const char* ScenarioName(Scenario scenario) {
+    switch (scenario) {
+        case Scenario::MOVING:
+            return "moving";
+        case Scenario::LOOK_FOR_HOME:
+            return "look_for_home";
+        case Scenario::IDLE:
+            return "idle";
+    }
+    return "?";
+}
+
+static uint16_t MinStepPeriod() {
+    uint16_t min_period = 0xFFFF;
+    const Acceleration::Profile &profile = *Acceleration::DEFAULT_PROFILE;
+    for (uint16_t i = 0; i <= profile.max_accel_step; i++) {
+        uint16_t period = pgm_read_word_near(profile.accel_step_periods + i);
+        if (period < min_period) {
+            min_period = period;
+        }
+    }
+    return min_period;
+}
+
+template <uint8_t N>
+class ModuleChain {
+ public:
+    ModuleChain() : motor_buffer_(), sensor_buffer_(), spool_step_(), last_motor_out_() {
+        for (uint8_t i = 0; i < N; i++) {
+            modules_.Configure(
+                i,
+                motor_buffer_[MOTOR_BUFFER_LENGTH - 1 - i/2],
+                i % 2 == 0 ? 0 : 4,
+                sensor_buffer_[i/4],
+                1 << (i % 4));
+            // Spread the spools out so they don't all home on the same pass
+            spool_step_[i] = (uint32_t)i * 97 % STEPS_PER_SPOOL_REVOLUTION;
+        }
+    }
+
+    SplitflapModuleBank<N>& Modules() {
+        return modules_;
+    }
+
+    // Runs one Update() pass over the bank and returns the elapsed wall clock time in nanoseconds.
+    uint64_t TimedPass() {
+        HostClock::Advance(PASS_INTERVAL_MICROS);
+
+        auto start = std::chrono::steady_clock::now();
+        modules_.Update();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    }
+
+    // Advances the spool model based on the motor outputs written during the last pass, and updates the home sensor
+    // inputs to match.
+    void SimulateSpools(bool sensors_connected) {
+        for (uint8_t i = 0; i < N; i++) {
+            uint8_t motor_out = (motor_buffer_[MOTOR_BUFFER_LENGTH - 1 - i/2] >> (i % 2 == 0 ? 0 : 4)) & 0x0F;
+            if (motor_out != 0 && motor_out != last_motor_out_[i]) {
+                spool_step_[i]++;
+                if (spool_step_[i] == STEPS_PER_SPOOL_REVOLUTION) {
+                    spool_step_[i] = 0;
+                }
+            }
+            last_motor_out_[i] = motor_out;
+
+            uint8_t mask = 1 << (i % 4);
+            if (sensors_connected && spool_step_[i] < HOME_SENSOR_WIDTH_STEPS) {
+                sensor_buffer_[i/4] |= mask;
+            } else {
+                sensor_buffer_[i/4] &= ~mask;
+            }
+        }
+    }
+
+ private:
+    static const uint8_t MOTOR_BUFFER_LENGTH = N / 2 + (N % 2 != 0);
+    static const uint8_t SENSOR_BUFFER_LENGTH = N / 4 + (N % 4 != 0);
+
+    uint8_t motor_buffer_[MOTOR_BUFFER_LENGTH];
+    uint8_t sensor_buffer_[SENSOR_BUFFER_LENGTH];
+    SplitflapModuleBank<N> modules_;
+
+    uint32_t spool_step_[N];
+    uint8_t last_motor_out_[N];
+};
+
+template <uint8_t N>
+static bool HomeAll(ModuleChain<N>& chain) {
+    SplitflapModuleBank<N>& modules = chain.Modules();
+    for (uint8_t i = 0; i < N; i++) {
+        modules.Init(i);
+        modules.GoHome(i);
+    }
+    for (uint32_t pass = 0; pass < MAX_HOMING_PASSES; pass++) {
+        chain.TimedPass();
+        chain.SimulateSpools(true);
+
+        bool all_homed = true;
+        for (uint8_t i = 0; i < N; i++) {
+            all_homed &= modules.state[i] == NORMAL && modules.current_accel_step[i] == 0;
+        }
+        if (all_homed) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Keeps every module in the state being measured. Runs between (untimed) passes.
+template <uint8_t N>
+static void MaintainScenario(ModuleChain<N>& chain, Scenario scenario) {
+    SplitflapModuleBank<N>& modules = chain.Modules();
+    for (uint8_t i = 0; i < N; i++) {
+        switch (scenario) {
+            case Scenario::MOVING:
+                if (modules.current_accel_step[i] == 0) {
+                    // Going to the current flap forces a full revolution
+                    modules.GoToFlapIndex(i, modules.GetCurrentFlapIndex(i));
+                }
+                break;
+            case Scenario::LOOK_FOR_HOME:
+                if (modules.state[i] != LOOK_FOR_HOME) {
+                    modules.GoHome(i);
+                }
+                break;
+            case Scenario::IDLE:
+                break;
+        }
+    }
+}
+
+template <uint8_t N>
+static void RunScenario(Scenario scenario, uint32_t passes, uint16_t min_period) {
+    // Large banks don't fit comfortably on the stack
+    std::unique_ptr<ModuleChain<N>> chain_storage(new ModuleChain<N>());
+    ModuleChain<N>& chain = *chain_storage;
+    if (!HomeAll(chain)) {
+        fprintf(stderr, "Modules failed to home with %u modules\n", N);
+        exit(1);
+    }
+
+    bool sensors_connected = scenario != Scenario::LOOK_FOR_HOME;
+    MaintainScenario(chain, scenario);
+    for (uint32_t pass = 0; pass < WARMUP_PASSES; pass++) {
+        chain.TimedPass();
+        chain.SimulateSpools(sensors_connected);
+        MaintainScenario(chain, scenario);
+    }
+
+    uint64_t total_ns = 0;
+    uint64_t max_pass_ns = 0;
+    for (uint32_t pass = 0; pass < passes; pass++) {
+        uint64_t pass_ns = chain.TimedPass();
+        total_ns += pass_ns;
+        if (pass_ns > max_pass_ns) {
+            max_pass_ns = pass_ns;
+        }
+        chain.SimulateSpools(sensors_connected);
+        MaintainScenario(chain, scenario);
+    }
+
+    double ns_per_update = (double)total_ns / passes / N;
+    double ns_per_pass = (double)total_ns / passes;
+    printf("%-14s %8u %12.1f %12.2f %12.2f %14.3f\n",
+        ScenarioName(scenario),
+        N,
+        ns_per_update,
+        ns_per_pass / 1000,
+        max_pass_ns / 1000.,
+        100 * ns_per_pass / 1000 / min_period);
+}
+
+int main(int argc, char** argv) {
+    uint32_t passes = 20000;
+    if (argc > 1) {
+        passes = strtoul(argv[1], NULL, 10);
+        if (passes == 0) {
+            fprintf(stderr, "Usage: %s [passes]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    const Scenario scenarios[] = {Scenario::MOVING, Scenario::LOOK_FOR_HOME, Scenario::IDLE};
+
+    uint16_t min_period = MinStepPeriod();
+    printf("%u passes per run; %% of min step period (%uus) is the mean pass time relative to the fastest step rate\n\n",
+        passes, min_period);
+    printf("%-14s %8s %12s %12s %12s %14s\n", "state", "modules", "ns/update", "us/pass", "max us/pass", "% min period");
+    for (Scenario scenario : scenarios) {
+        RunScenario<12>(scenario, passes, min_period);
+    }
+    for (Scenario scenario : scenarios) {
+        RunScenario<108>(scenario, passes, min_period);
+    }
+    for (Scenario scenario : scenarios) {
+        RunScenario<255>(scenario, passes, min_period);
+    }
+    return 0;
+}
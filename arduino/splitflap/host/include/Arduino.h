@@ -0,0 +1,97 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+#pragma once
+
+// Minimal stand-in for the Arduino core, just enough to compile the splitflap module driver (Splitflap/src) natively
+// on a desktop host. Time is fully controlled by the caller (see HostClock) so that benchmarks and simulations are
+// deterministic and don't depend on how fast the host happens to run.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define pgm_read_byte_near(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word_near(addr) (*(const uint16_t *)(addr))
+#define F(x) (x)
+
+#define B00000001 1
+#define B00000010 2
+#define B00000100 4
+#define B00001000 8
+#define B00010000 16
+#define B00100000 32
+#define B01000000 64
+#define B10000000 128
+
+namespace HostClock {
+    inline unsigned long& Micros() {
+        static unsigned long now_micros = 0;
+        return now_micros;
+    }
+
+    inline void Set(unsigned long now_micros) {
+        Micros() = now_micros;
+    }
+
+    inline void Advance(unsigned long delta_micros) {
+        Micros() += delta_micros;
+    }
+}
+
+inline unsigned long micros() {
+    return HostClock::Micros();
+}
+
+inline unsigned long millis() {
+    return HostClock::Micros() / 1000;
+}
+
+class String {
+ public:
+    String(const char* str = "") : str_(str) {}
+    String(const std::string& str) : str_(str) {}
+    const char* c_str() const { return str_.c_str(); }
+    String operator+(const String& other) const { return String(str_ + other.str_); }
+
+ private:
+    std::string str_;
+};
+
+// Serial output is forwarded to stderr so it doesn't get mixed up with benchmark/report output on stdout.
+class HostSerial {
+ public:
+    void begin(unsigned long) {}
+    void flush() { fflush(stderr); }
+    void print(const char* str) { fputs(str, stderr); }
+    void print(const String& str) { fputs(str.c_str(), stderr); }
+    void print(char c) { fputc(c, stderr); }
+    void print(long value) { fprintf(stderr, "%ld", value); }
+    void print(unsigned long value) { fprintf(stderr, "%lu", value); }
+    void print(int value) { print((long)value); }
+    void print(unsigned int value) { print((unsigned long)value); }
+    void write(uint8_t c) { fputc(c, stderr); }
+    template <typename T>
+    void println(T value) { print(value); print('\n'); }
+    void println() { print('\n'); }
+};
+
+static HostSerial Serial;
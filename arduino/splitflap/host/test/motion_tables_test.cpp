@@ -0,0 +1,325 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+// Checks the tables the driver generates at compile time against the arithmetic they replace, at run time:
+// - the acceleration ramps in acceleration.h, against the floating point ramps generate_acceleration.py produces
+// - the flap boundary table behind GetFlapFloor() and GetTargetStepForFlapIndex(), against the gear ratio division,
+//   both directly and by driving a module through a full revolution of moves against a simulated spool, with and
+//   without a home offset, and with a glitch on the home sensor that the debounce has to ignore
+//
+// CMakeLists.txt builds this once for each combination of HALF_STEP and S_CURVE_ACCELERATION. Exits non-zero if any
+// check fails.
+
+#include <Arduino.h>
+
+#include <vector>
+
+#include "src/splitflap_module.h"
+
+typedef ModuleGeometry<DefaultModuleTraits> Geometry;
+typedef SplitflapModuleBank<1> Modules;
+
+static const uint32_t STEPS_PER_SPOOL_REVOLUTION = Geometry::GEAR_RATIO_INPUT_STEPS / DefaultModuleTraits::GEAR_RATIO_OUTPUT;
+static const uint32_t HOME_SENSOR_WIDTH_STEPS = Geometry::ROUGH_STEPS_PER_FLAP / 2;
+
+// Upper bound on the steps any single move or home search in this test takes
+static const uint32_t MAX_STEPS_PER_MOVE = 3 * STEPS_PER_SPOOL_REVOLUTION;
+
+static uint32_t failures = 0;
+
+#define CHECK(condition, ...) \
+    do { \
+        if (!(condition)) { \
+            failures++; \
+            printf("FAIL %s:%d: %s: ", __FILE__, __LINE__, #condition); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+        } \
+    } while (0)
+
+// Ports of generate_acceleration.py's ramp shapes and generate_ramp(), keeping its floating point arithmetic in the
+// same order so that the periods round the same way
+static double Linear(double x) {
+    return x;
+}
+
+static double SCurve(double x) {
+    if (x < 0.5) {
+        return 2 * x * x;
+    }
+    return 1 - 2 * (1 - x) * (1 - x);
+}
+
+static std::vector<uint16_t> ReferenceRamp(uint16_t min_period, uint16_t max_period, uint32_t ramp_time,
+        double (*shape)(double)) {
+    double min_velocity = 1000000 / (double)max_period;
+    double max_velocity = 1000000 / (double)min_period;
+
+    std::vector<uint16_t> periods;
+    uint32_t t = 0;
+    while (t < ramp_time) {
+        double velocity = min_velocity + (max_velocity - min_velocity) * shape((double)t / ramp_time);
+        if (velocity > max_velocity) {
+            velocity = max_velocity;
+        }
+        uint16_t period = (uint16_t)(1000000 / velocity);
+        periods.push_back(period);
+        t += period;
+    }
+    return periods;
+}
+
+// Checks a generated table (which starts with the idle period) against the reference ramp, padded out at min_period
+// to the table's length
+static void CheckTable(const char* name, const uint16_t* table, uint16_t max_accel_step, std::vector<uint16_t> ramp,
+        uint16_t min_period) {
+    CHECK(max_accel_step >= ramp.size(), "%s has %u steps, reference ramp has %u", name, max_accel_step,
+        (unsigned)ramp.size());
+    ramp.resize(max_accel_step, min_period);
+    CHECK(pgm_read_word_near(table) == Acceleration::IDLE_PERIOD, "%s starts with %u, not the idle period %u", name,
+        pgm_read_word_near(table), Acceleration::IDLE_PERIOD);
+    for (uint16_t step = 1; step <= max_accel_step; step++) {
+        uint16_t period = pgm_read_word_near(table + step);
+        CHECK(period == ramp[step - 1], "%s step %u is %u us, reference is %u us", name, step, period, ramp[step - 1]);
+        if (step > 1) {
+            uint16_t previous = pgm_read_word_near(table + step - 1);
+            CHECK(period <= previous, "%s slows down from %u us to %u us at step %u", name, previous, period, step);
+        }
+    }
+}
+
+static void TestAccelerationTables() {
+    using namespace Acceleration;
+    const uint16_t min_period = ACCEL_MIN_PERIOD_MICROS / MICROSTEPS_PER_STEP;
+    const uint16_t max_period = ACCEL_MAX_PERIOD_MICROS / MICROSTEPS_PER_STEP;
+    const uint16_t s_curve_min_period = S_CURVE_MIN_PERIOD_MICROS / MICROSTEPS_PER_STEP;
+
+    std::vector<uint16_t> linear = ReferenceRamp(min_period, max_period, ACCEL_TIME_MICROS, Linear);
+    CHECK(MAX_ACCEL_STEP == linear.size(), "linear ramp has %u steps, reference has %u", MAX_ACCEL_STEP,
+        (unsigned)linear.size());
+    CheckTable("ACCEL_STEP_PERIODS", ACCEL_STEP_PERIODS, MAX_ACCEL_STEP, linear, min_period);
+
+    // Accel and decel share a length: the shorter one is padded out at top speed
+    std::vector<uint16_t> s_curve_accel = ReferenceRamp(s_curve_min_period, max_period, S_CURVE_ACCEL_TIME_MICROS, SCurve);
+    std::vector<uint16_t> s_curve_decel = ReferenceRamp(s_curve_min_period, max_period, S_CURVE_DECEL_TIME_MICROS, SCurve);
+    size_t s_curve_steps = s_curve_accel.size() > s_curve_decel.size() ? s_curve_accel.size() : s_curve_decel.size();
+    CHECK(S_CURVE_MAX_ACCEL_STEP == s_curve_steps, "S-curve ramps have %u steps, reference has %u", S_CURVE_MAX_ACCEL_STEP,
+        (unsigned)s_curve_steps);
+    CheckTable("S_CURVE_ACCEL_STEP_PERIODS", S_CURVE_ACCEL_STEP_PERIODS, S_CURVE_MAX_ACCEL_STEP, s_curve_accel,
+        s_curve_min_period);
+    CheckTable("S_CURVE_DECEL_STEP_PERIODS", S_CURVE_DECEL_STEP_PERIODS, S_CURVE_MAX_ACCEL_STEP, s_curve_decel,
+        s_curve_min_period);
+
+    CHECK(DEFAULT_PROFILE == (S_CURVE_ACCELERATION ? &S_CURVE : &LINEAR), "default profile doesn't follow "
+        "S_CURVE_ACCELERATION (%d)", S_CURVE_ACCELERATION);
+}
+
+// The flap a step is on, by the division the flap boundary table replaces
+static uint32_t DividedFlapFloor(uint32_t step) {
+    return (uint64_t)step * Geometry::GEAR_RATIO_OUTPUT_FLAPS / Geometry::GEAR_RATIO_INPUT_STEPS;
+}
+
+static void TestFlapBoundaries() {
+    typedef FlapSteps::Generate<Geometry, Geometry::FLAP_BOUNDARY_COUNT>::Type FirstSteps;
+    for (uint32_t flap = 0; flap < Geometry::FLAP_BOUNDARY_COUNT; flap++) {
+        uint64_t expected = ((uint64_t)flap * Geometry::GEAR_RATIO_INPUT_STEPS + Geometry::GEAR_RATIO_OUTPUT_FLAPS - 1)
+            / Geometry::GEAR_RATIO_OUTPUT_FLAPS;
+        uint16_t first_step = pgm_read_word_near(FirstSteps::first_step + flap);
+        CHECK(first_step == expected, "flap boundary %u is at step %u, expected %u", flap, first_step, (unsigned)expected);
+    }
+
+    // RestorePosition() only accepts the first step of the given flap, as found by GetFlapFloor()
+    uint8_t motor_buffer = 0;
+    uint8_t sensor_buffer = 0;
+    Modules modules;
+    modules.Configure(0, motor_buffer, 0, sensor_buffer, 1);
+    modules.Init(0);
+    for (uint32_t step = 0; step < Geometry::GEAR_RATIO_INPUT_STEPS; step++) {
+        uint32_t flap = DividedFlapFloor(step);
+        bool first_step = step == 0 || DividedFlapFloor(step - 1) != flap;
+        uint8_t flap_index = flap % NUM_FLAPS;
+        bool restored = modules.RestorePosition(0, step, flap_index);
+        CHECK(restored == first_step, "restoring step %u on flap %u returned %d", step, flap_index, restored);
+        if (restored) {
+            CHECK(modules.GetCurrentFlapIndex(0) == flap_index, "step %u restored onto flap %u, expected %u", step,
+                modules.GetCurrentFlapIndex(0), flap_index);
+        }
+    }
+}
+
+// One module wired to a spool that turns with its motor output and covers the home sensor for the first
+// HOME_SENSOR_WIDTH_STEPS of each revolution, as in module_update_benchmark. Optionally, when the spool reaches
+// glitch_step the sensor reads high for a burst of GLITCH_SAMPLES quick samples, like noise from the motor drivers: more
+// samples than a debounce that counted them would need, but over less time than HOME_SENSOR_DEBOUNCE_MICROS.
+class SimulatedModule {
+ public:
+    SimulatedModule(uint32_t glitch_step = NO_GLITCH) : motor_buffer_(0), sensor_buffer_(0), sensor_micros_(0),
+            spool_step_(STEPS_PER_SPOOL_REVOLUTION / 3), glitch_step_(glitch_step), last_motor_out_(0),
+            min_step_period_(0xFFFFFFFF) {
+        modules_.Configure(0, motor_buffer_, 0, sensor_buffer_, 1);
+        UpdateSensor();
+        modules_.Init(0);
+    }
+
+    static const uint32_t NO_GLITCH = 0xFFFFFFFF;
+
+    Modules& modules() {
+        return modules_;
+    }
+
+    // Where the spool is, in steps after the home sensor's edge
+    uint32_t spool_step() const {
+        return spool_step_;
+    }
+
+    // Shortest time seen between two steps of a move
+    uint32_t min_step_period() const {
+        return min_step_period_;
+    }
+
+    // Runs Update() at each time the module asks to be stepped, until it stops. Returns false if it doesn't.
+    bool RunUntilStopped() {
+        bool stepped = false;
+        unsigned long last_step_micros = 0;
+        for (uint32_t pass = 0; pass < MAX_STEPS_PER_MOVE; pass++) {
+            unsigned long step_micros;
+            if (!modules_.IsMoving(0) || !modules_.GetNextStepMicros(step_micros)) {
+                return !modules_.IsMoving(0);
+            }
+            if ((long)(step_micros - micros()) > 0) {
+                HostClock::Set(step_micros);
+            }
+            // The sensor was last read right after the previous step, which is where its edges are
+            modules_.Update(sensor_micros_);
+
+            uint8_t motor_out = motor_buffer_ & 0x0F;
+            if (motor_out != 0 && motor_out != last_motor_out_) {
+                if (stepped && micros() - last_step_micros < min_step_period_) {
+                    min_step_period_ = micros() - last_step_micros;
+                }
+                stepped = true;
+                last_step_micros = micros();
+                spool_step_ = (spool_step_ + 1) % STEPS_PER_SPOOL_REVOLUTION;
+            }
+            last_motor_out_ = motor_out;
+            UpdateSensor();
+            if (spool_step_ == glitch_step_) {
+                SampleGlitch();
+            }
+        }
+        return false;
+    }
+
+ private:
+    void UpdateSensor() {
+        sensor_buffer_ = spool_step_ < HOME_SENSOR_WIDTH_STEPS ? 1 : 0;
+        sensor_micros_ = micros();
+    }
+
+    void SampleGlitch() {
+        unsigned long step_micros;
+        for (uint8_t sample = 0; sample < GLITCH_SAMPLES; sample++) {
+            // Keep clear of the next step, which RunUntilStopped() has to see
+            if (!modules_.GetNextStepMicros(step_micros) || (long)(step_micros - micros()) <= (long)GLITCH_SAMPLE_MICROS) {
+                break;
+            }
+            HostClock::Set(micros() + GLITCH_SAMPLE_MICROS);
+            sensor_buffer_ = 1;
+            sensor_micros_ = micros();
+            modules_.Update(sensor_micros_);
+        }
+        UpdateSensor();
+    }
+
+    static const uint8_t GLITCH_SAMPLES = 4;
+    static const uint32_t GLITCH_SAMPLE_MICROS = DefaultModuleTraits::HOME_SENSOR_DEBOUNCE_MICROS / (GLITCH_SAMPLES + 1);
+
+    uint8_t motor_buffer_;
+    uint8_t sensor_buffer_;
+    unsigned long sensor_micros_;
+    Modules modules_;
+    uint32_t spool_step_;
+    uint32_t glitch_step_;
+    uint8_t last_motor_out_;
+    uint32_t min_step_period_;
+};
+
+// Homes a module with the given home offset, then sends it to every flap in turn (and to the flap it's already on, which
+// takes a full revolution). Each move has to end on the first step of the target flap, home_offset steps from the home
+// sensor's edge, without the home sensor ever turning up somewhere the flap boundaries say it shouldn't (even with a
+// single sample glitch halfway round, if sensor_glitch is set).
+static void TestMoves(int8_t home_offset, bool sensor_glitch = false) {
+    // Mid-flap, so the module is always moving past it rather than stopped on it
+    SimulatedModule module(sensor_glitch ? STEPS_PER_SPOOL_REVOLUTION / 2 + Geometry::ROUGH_STEPS_PER_FLAP / 2
+            : SimulatedModule::NO_GLITCH);
+    Modules& modules = module.modules();
+    modules.home_offset[0] = home_offset;
+    modules.GoHome(0);
+    bool homed = module.RunUntilStopped();
+    CHECK(homed && modules.state[0] == NORMAL, "module didn't home (state %d)", modules.state[0]);
+    if (!homed) {
+        return;
+    }
+
+    for (uint16_t move = 0; move <= NUM_FLAPS; move++) {
+        uint8_t target = move % NUM_FLAPS;
+        modules.GoToFlapIndex(0, target);
+        bool stopped = module.RunUntilStopped();
+        CHECK(stopped && modules.state[0] == NORMAL, "move to flap %u didn't finish (state %d)", target, modules.state[0]);
+        CHECK(modules.GetCurrentFlapIndex(0) == target, "move to flap %u ended on flap %u", target,
+            modules.GetCurrentFlapIndex(0));
+
+        uint32_t step = modules.GetCurrentStep(0);
+        uint32_t flap = DividedFlapFloor(step);
+        CHECK(flap % NUM_FLAPS == target && (step == 0 || DividedFlapFloor(step - 1) != flap),
+            "move to flap %u ended at step %u, which isn't where the flap starts", target, step);
+        uint32_t expected_spool_step = (step + STEPS_PER_SPOOL_REVOLUTION - home_offset) % STEPS_PER_SPOOL_REVOLUTION;
+        CHECK(module.spool_step() == expected_spool_step, "move to flap %u with home offset %d ended with the spool at "
+            "step %u, expected %u", target, home_offset, module.spool_step(), expected_spool_step);
+    }
+    CHECK(modules.count_missed_home[0] == 0 && modules.count_unexpected_home[0] == 0,
+        "%u missed and %u unexpected homes with home offset %d", modules.count_missed_home[0],
+        modules.count_unexpected_home[0], home_offset);
+
+    const Acceleration::Profile& profile = *Acceleration::DEFAULT_PROFILE;
+    uint16_t min_period = pgm_read_word_near(profile.accel_step_periods + profile.max_accel_step);
+    uint16_t min_decel_period = pgm_read_word_near(profile.decel_step_periods + profile.max_accel_step);
+    if (min_decel_period < min_period) {
+        min_period = min_decel_period;
+    }
+    CHECK(module.min_step_period() >= min_period, "stepped every %u us, faster than the profile's %u us",
+        module.min_step_period(), min_period);
+    CHECK(modules.home_offset[0] == home_offset, "home offset changed from %d to %d", home_offset,
+        modules.home_offset[0]);
+}
+
+int main() {
+    printf("HALF_STEP=%d S_CURVE_ACCELERATION=%d\n", HALF_STEP, S_CURVE_ACCELERATION);
+    TestAccelerationTables();
+    TestFlapBoundaries();
+    // As far from the gearing's home as RecordHomeOffsetSample() lets the offset get, either way
+    const int8_t max_home_offset = Geometry::ROUGH_STEPS_PER_FLAP / 2 < 127 ? Geometry::ROUGH_STEPS_PER_FLAP / 2 : 127;
+    TestMoves(0);
+    TestMoves(max_home_offset);
+    TestMoves(-max_home_offset);
+    TestMoves(0, true);
+    if (failures > 0) {
+        printf("%u checks failed\n", failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
@@ -0,0 +1,473 @@
+/*
+   Copyright 2021 Scott Bezek and the splitflap contributors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+// Searches for the fastest acceleration ramps that a module can follow without losing steps, by running the real
+// SplitflapModuleBank stepping logic against a physics model of a 28BYJ-48 motor turning a flap spool through its
+// gearbox, and prints the winning ramps as build flags for platformio.ini (see ACCEL_* and S_CURVE_* in config.h).
+//
+// The motor is modelled at the rotor: each coil's current lags its drive through the coil's L/R time constant and is
+// opposed by back-EMF, so the torque available falls off with speed (the pull-out torque curve). The rotor also feels
+// the detent torque of its magnets, and the spool's inertia, friction and the pull of each flap falling over, seen
+// through the gearbox. A step is lost if the rotor ever lags (or leads) the field by more than half an electrical
+// cycle, past which it falls back into a different pole.
+//
+// The safety margin is taken off the motor torque: a ramp only counts if it still works with that much less torque
+// than the model says the motor has, which also covers some error in the other parameters.
+//
+// Usage: acceleration_tuner [--margin percent] [--coil-torque mNm] [--time-constant us] [--spool-friction mNm]
+//            [--spool-inertia gcm2] [--max-period us]
+
+#include <Arduino.h>
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "src/splitflap_module.h"
+
+typedef ModuleGeometry<DefaultModuleTraits> Geometry;
+
+// Motor revolutions per spool revolution
+static const double GEAR_RATIO = (double)DefaultModuleTraits::GEAR_RATIO_INPUT / DefaultModuleTraits::GEAR_RATIO_OUTPUT;
+static const uint32_t STEPS_PER_SPOOL_REVOLUTION = Geometry::GEAR_RATIO_INPUT_STEPS / DefaultModuleTraits::GEAR_RATIO_OUTPUT;
+static const uint32_t HOME_SENSOR_WIDTH_STEPS = Geometry::ROUGH_STEPS_PER_FLAP / 2;
+
+// Electrical cycles per motor revolution (there are 4 full steps per electrical cycle)
+static const double POLE_PAIRS = STEPS_PER_MOTOR_REVOLUTION / (HALF_STEP ? 8. : 4.);
+static const double ELECTRICAL_RADIANS_PER_STEP = 2 * M_PI / (HALF_STEP ? 8 : 4);
+
+static const uint32_t PHYSICS_TICK_MICROS = 10;
+static const uint32_t DWELL_MICROS = 300000;
+static const uint32_t MOVE_TIMEOUT_MICROS = 30000000;
+
+// Longest ramp acceleration.h can generate at compile time
+static const uint16_t MAX_RAMP_STEPS = 480;
+
+struct MotorModel {
+    // Torque at the rotor from one coil at full current (N m). Two coils give sqrt(2) times as much.
+    double coil_torque = 0.0011;
+    // L/R of a coil (s)
+    double electrical_time_constant = 0.0012;
+    // Rotor speed at which a coil's back-EMF would match the supply voltage (rad/s)
+    double back_emf_speed = 900;
+    // Peak detent (unpowered cogging) torque at the rotor (N m)
+    double detent_torque = 0.00005;
+    double rotor_inertia = 3e-8;
+    double gearbox_efficiency = 0.7;
+    // Viscous losses at the rotor (N m s/rad)
+    double rotor_damping = 2e-7;
+
+    // Spool inertia including flaps (kg m^2)
+    double spool_inertia = 4e-5;
+    // Friction of the spool and flaps against their stop (N m, at the spool)
+    double spool_friction = 0.010;
+    // Peak torque from each flap being pulled over the top and then falling (N m, at the spool)
+    double flap_torque = 0.004;
+};
+
+// The motor, gearbox and spool of one module. Tracks the rotor and the field it's being pulled towards in electrical
+// radians, both counting up from 0 as the module moves forward.
+class ModulePhysics {
+ public:
+    ModulePhysics(const MotorModel& model, double torque_scale, uint32_t start_step)
+            : model_(model), torque_scale_(torque_scale), current_(), motor_out_(0), phase_(0) {
+        // Start at rest in the position of the first (two coil) step of the step pattern, where the driver starts
+        rotor_ = field_ = M_PI / 4;
+        rotor_speed_ = 0;
+        spool_offset_steps_ = start_step;
+        inertia_ = model.rotor_inertia + model.spool_inertia / (GEAR_RATIO * GEAR_RATIO);
+        peak_lag_ = 0;
+    }
+
+    // Notes the coils the driver has just energized, moving the field on by however far that is along the step pattern
+    void SetMotor(uint8_t motor_out) {
+        motor_out_ = motor_out;
+        if (motor_out == 0) {
+            return;
+        }
+        for (uint8_t phase = 0; phase < sizeof(step_pattern); phase++) {
+            if (step_pattern[phase] == motor_out) {
+                field_ += (phase + sizeof(step_pattern) - phase_) % sizeof(step_pattern) * ELECTRICAL_RADIANS_PER_STEP;
+                phase_ = phase;
+                return;
+            }
+        }
+    }
+
+    void Run(uint32_t micros) {
+        while (micros > 0) {
+            uint32_t tick = micros < PHYSICS_TICK_MICROS ? micros : PHYSICS_TICK_MICROS;
+            Tick(tick * 1e-6);
+            micros -= tick;
+        }
+    }
+
+    // Home sensor reading for the spool's actual position
+    bool HomeSensor() const {
+        double steps = rotor_ / ELECTRICAL_RADIANS_PER_STEP + spool_offset_steps_;
+        return (uint32_t)fmod(steps, STEPS_PER_SPOOL_REVOLUTION) < HOME_SENSOR_WIDTH_STEPS;
+    }
+
+    bool LostStep() const {
+        return peak_lag_ > M_PI;
+    }
+
+    // Worst lag (or lead) of the rotor behind the field so far, as a fraction of the lag at which a step is lost
+    double PeakLag() const {
+        return peak_lag_ / M_PI;
+    }
+
+ private:
+    void Tick(double dt) {
+        // Coil A's field points at 0, B's at pi/2, and so on (see MOT_PHASE_A..D)
+        static const uint8_t COIL_BITS[4] = {MOT_PHASE_A, MOT_PHASE_B, MOT_PHASE_C, MOT_PHASE_D};
+        double s = sin(rotor_);
+        double c = cos(rotor_);
+        // sin(rotor_ - coil * pi/2) for each coil
+        const double coil_sin[4] = {s, -c, -s, c};
+        double torque = 0;
+        for (uint8_t coil = 0; coil < 4; coil++) {
+            double drive = (motor_out_ & COIL_BITS[coil]) ? 1 : 0;
+            // Back-EMF of a coil is proportional to speed and to how strongly the rotor's magnet links it. Unipolar
+            // drivers can't reverse the current, which would otherwise be pushed below 0 (the driver's clamp diodes
+            // let it decay to 0 instead).
+            double back_emf = -coil_sin[coil] * rotor_speed_ / model_.back_emf_speed;
+            current_[coil] += (drive - current_[coil] - back_emf) * dt / model_.electrical_time_constant;
+            if (current_[coil] < 0) {
+                current_[coil] = 0;
+            }
+            torque -= torque_scale_ * model_.coil_torque * current_[coil] * coil_sin[coil];
+        }
+        // sin(4 * rotor_)
+        torque -= model_.detent_torque * 4 * s * c * (c * c - s * s);
+
+        // Spool load, as seen at the rotor. Friction only acts against motion (or against starting to move).
+        double spool_angle = rotor_ / POLE_PAIRS / GEAR_RATIO;
+        double flap_load = model_.flap_torque * sin(spool_angle * DefaultModuleTraits::FLAP_COUNT);
+        double gearbox = GEAR_RATIO * model_.gearbox_efficiency;
+        torque -= flap_load / gearbox + model_.rotor_damping * rotor_speed_;
+        double friction = model_.spool_friction / gearbox;
+        if (rotor_speed_ == 0 && fabs(torque) <= friction) {
+            torque = 0;
+        } else {
+            double moving = rotor_speed_ != 0 ? rotor_speed_ : torque;
+            torque -= moving > 0 ? friction : -friction;
+        }
+
+        double old_speed = rotor_speed_;
+        rotor_speed_ += torque / inertia_ * dt;
+        // Friction can stop the rotor, but not push it backwards
+        if ((old_speed > 0 && rotor_speed_ < 0) || (old_speed < 0 && rotor_speed_ > 0)) {
+            rotor_speed_ = 0;
+        }
+        rotor_ += rotor_speed_ * POLE_PAIRS * dt;
+
+        if (motor_out_ != 0) {
+            double lag = fabs(field_ - rotor_);
+            if (lag > peak_lag_) {
+                peak_lag_ = lag;
+            }
+        }
+    }
+
+    const MotorModel& model_;
+    const double torque_scale_;
+    double inertia_;
+
+    // Rotor position in electrical radians, and its speed in mechanical rad/s
+    double rotor_;
+    double rotor_speed_;
+    double field_;
+    double current_[4];
+    double spool_offset_steps_;
+
+    uint8_t motor_out_;
+    uint8_t phase_;
+    double peak_lag_;
+};
+
+// A pair of ramps to try, per full step like the settings in config.h
+struct Candidate {
+    uint16_t min_period;
+    uint32_t accel_time;
+    uint32_t decel_time;
+    Acceleration::RampShape shape;
+};
+
+struct TrialResult {
+    bool ok;
+    const char* failure;
+    // Total time spent on the test moves
+    double move_seconds;
+    double peak_lag;
+};
+
+// Moves (in flaps) that every candidate is tried on, starting from home. A move of FLAP_COUNT is a full revolution,
+// which also checks that the home sensor is still where the driver expects it.
+static const uint8_t TEST_MOVES[] = {1, 3, 8, 20, DefaultModuleTraits::FLAP_COUNT};
+
+class Tuner {
+    // A bank of one module: the tuner only ever simulates a single spool
+    typedef SplitflapModuleBank<1> Modules;
+
+ public:
+    Tuner(const MotorModel& model, double torque_scale, uint16_t max_period)
+        : model_(model), torque_scale_(torque_scale), max_period_(max_period) {}
+
+    // Fills in the tables for a candidate, as acceleration.h would generate them. Returns false if the ramps would be
+    // too long to generate.
+    bool BuildProfile(const Candidate& candidate, Acceleration::Profile& profile) {
+        Acceleration::RampParams accel = {
+            (uint16_t)(candidate.min_period / Acceleration::MICROSTEPS_PER_STEP),
+            (uint16_t)(max_period_ / Acceleration::MICROSTEPS_PER_STEP),
+            candidate.accel_time,
+            candidate.shape,
+        };
+        Acceleration::RampParams decel = accel;
+        decel.ramp_time = candidate.decel_time;
+        if (!Acceleration::IsValidRamp(accel) || !Acceleration::IsValidRamp(decel)) {
+            return false;
+        }
+
+        uint16_t steps = Acceleration::RampSteps(accel);
+        uint16_t decel_steps = Acceleration::RampSteps(decel);
+        if (decel_steps > steps) {
+            steps = decel_steps;
+        }
+        if (steps > MAX_RAMP_STEPS) {
+            return false;
+        }
+        FillTable(accel, steps, accel_periods_);
+        FillTable(decel, steps, decel_periods_);
+        profile.accel_step_periods = accel_periods_;
+        profile.decel_step_periods = decel_periods_;
+        profile.max_accel_step = steps;
+        return true;
+    }
+
+    TrialResult Run(const Candidate& candidate) {
+        TrialResult result = {false, "ramp too long", 0, 0};
+        Acceleration::Profile profile;
+        if (!BuildProfile(candidate, profile)) {
+            return result;
+        }
+
+        uint8_t motor_out = 0;
+        uint8_t sensor_in = 0;
+        Modules modules;
+        modules.Configure(0, motor_out, 0, sensor_in, 1);
+        // Start the spool at home, and tell the driver so rather than have it find home (the same for every candidate
+        // and slow to simulate)
+        ModulePhysics physics(model_, torque_scale_, 0);
+        HostClock::Set(0);
+
+        modules.Init(0);
+        modules.SetAccelerationProfile(0, profile);
+        modules.RestorePosition(0, 0, 0);
+
+        unsigned long start_micros = micros();
+        for (uint8_t move : TEST_MOVES) {
+            uint8_t target = (modules.GetCurrentFlapIndex(0) + move) % DefaultModuleTraits::FLAP_COUNT;
+            modules.GoToFlapIndex(0, target);
+            if (!RunUntilStopped(modules, physics, motor_out, sensor_in, result)) {
+                return result;
+            }
+            if (modules.GetCurrentFlapIndex(0) != target) {
+                result.failure = "wrong flap";
+                return result;
+            }
+            physics.Run(DWELL_MICROS);
+            HostClock::Advance(DWELL_MICROS);
+        }
+        result.ok = true;
+        result.failure = NULL;
+        result.move_seconds = (micros() - start_micros - sizeof(TEST_MOVES) * DWELL_MICROS) * 1e-6;
+        result.peak_lag = physics.PeakLag();
+        return result;
+    }
+
+ private:
+    static void FillTable(Acceleration::RampParams ramp, uint16_t steps, uint16_t* periods) {
+        periods[0] = ACCEL_IDLE_PERIOD_MICROS / Acceleration::MICROSTEPS_PER_STEP;
+        uint32_t t = 0;
+        for (uint16_t step = 0; step < steps; step++) {
+            uint16_t period = t < ramp.ramp_time ? Acceleration::PeriodAtTime(ramp, t) : ramp.min_period;
+            periods[step + 1] = period;
+            t += period;
+        }
+    }
+
+    // Runs the driver and the physics in lockstep until the module has come to a stop (or something went wrong)
+    bool RunUntilStopped(Modules& modules, ModulePhysics& physics, uint8_t& motor_out,
+            uint8_t& sensor_in, TrialResult& result) {
+        unsigned long deadline = micros() + MOVE_TIMEOUT_MICROS;
+        while (modules.IsMoving(0)) {
+            unsigned long step_micros;
+            if (modules.GetNextStepMicros(step_micros) && (long)(step_micros - micros()) > 0) {
+                physics.Run(step_micros - micros());
+                HostClock::Set(step_micros);
+            }
+            sensor_in = physics.HomeSensor() ? 1 : 0;
+            modules.Update();
+            physics.SetMotor(motor_out & 0x0F);
+
+            if (physics.LostStep()) {
+                result.failure = "lost step";
+                result.peak_lag = physics.PeakLag();
+                return false;
+            }
+            if (modules.state[0] != NORMAL) {
+                result.failure = "home sensor error";
+                return false;
+            }
+            if ((long)(micros() - deadline) > 0) {
+                result.failure = "timed out";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const MotorModel& model_;
+    const double torque_scale_;
+    const uint16_t max_period_;
+
+    uint16_t accel_periods_[MAX_RAMP_STEPS + 1];
+    uint16_t decel_periods_[MAX_RAMP_STEPS + 1];
+};
+
+static void PrintResult(const char* name, const Candidate& candidate, const TrialResult& result) {
+    printf("%-18s %6u %8u %8u   ", name, candidate.min_period, candidate.accel_time / 1000, candidate.decel_time / 1000);
+    if (result.ok) {
+        printf("%8.3f %9.0f%%\n", result.move_seconds, result.peak_lag * 100);
+    } else {
+        printf("%s\n", result.failure);
+    }
+}
+
+// Finds the shortest min period (to within 10us) that works with the rest of the candidate, assuming that anything
+// slower than a working period also works. Returns false if even the slowest doesn't.
+static bool FindFastest(Tuner& tuner, Candidate& candidate, TrialResult& result, uint16_t max_period) {
+    uint16_t works = max_period;
+    uint16_t fails = 300;
+    TrialResult works_result = {false, NULL, 0, 0};
+    while (works - fails > 10) {
+        uint16_t mid = (works + fails) / 2;
+        candidate.min_period = mid;
+        TrialResult trial = tuner.Run(candidate);
+        if (trial.ok) {
+            works = mid;
+            works_result = trial;
+        } else {
+            fails = mid;
+        }
+    }
+    if (!works_result.ok) {
+        return false;
+    }
+    candidate.min_period = works;
+    result = works_result;
+    return true;
+}
+
+static Candidate Search(Tuner& tuner, Acceleration::RampShape shape, uint16_t max_period, TrialResult& best_result) {
+    Candidate best = {0, 0, 0, shape};
+    best_result.ok = false;
+    for (uint32_t accel_time = 100000; accel_time <= 600000; accel_time += 50000) {
+        // The linear ramp is mirrored for deceleration, so only S-curves have a separate decel time to
+        // choose. Stopping is where steps get lost, so it never pays to decelerate harder than to accelerate.
+        uint32_t decel_to = shape == Acceleration::RAMP_LINEAR ? accel_time : 600000;
+        for (uint32_t decel_time = accel_time; decel_time <= decel_to; decel_time += 50000) {
+            Candidate candidate = {0, accel_time, decel_time, shape};
+            TrialResult result;
+            if (FindFastest(tuner, candidate, result, max_period)
+                    && (!best_result.ok || result.move_seconds < best_result.move_seconds)) {
+                best = candidate;
+                best_result = result;
+            }
+        }
+    }
+    return best;
+}
+
+static bool ParseArg(int argc, char** argv, int& i, const char* name, double& value) {
+    if (strcmp(argv[i], name) != 0 || i + 1 >= argc) {
+        return false;
+    }
+    value = strtod(argv[++i], NULL);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    MotorModel model;
+    double margin_percent = 25;
+    double max_period = ACCEL_MAX_PERIOD_MICROS;
+    for (int i = 1; i < argc; i++) {
+        double value;
+        if (ParseArg(argc, argv, i, "--margin", margin_percent) || ParseArg(argc, argv, i, "--max-period", max_period)) {
+            continue;
+        } else if (ParseArg(argc, argv, i, "--coil-torque", value)) {
+            model.coil_torque = value / 1000;
+        } else if (ParseArg(argc, argv, i, "--time-constant", value)) {
+            model.electrical_time_constant = value / 1e6;
+        } else if (ParseArg(argc, argv, i, "--spool-friction", value)) {
+            model.spool_friction = value / 1000;
+        } else if (ParseArg(argc, argv, i, "--spool-inertia", value)) {
+            model.spool_inertia = value * 1e-7;
+        } else {
+            fprintf(stderr, "Usage: %s [--margin percent] [--coil-torque mNm] [--time-constant us] "
+                "[--spool-friction mNm] [--spool-inertia gcm2] [--max-period us]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (margin_percent < 0 || margin_percent >= 100 || max_period <= 300 || max_period > 0xFFFF) {
+        fprintf(stderr, "Margin must be 0-99%% and max period 301-65535us\n");
+        return 1;
+    }
+
+    Tuner tuner(model, 1 - margin_percent / 100, max_period);
+    printf("%s, %.0f%% torque margin. Periods are per full step.\n\n", HALF_STEP ? "Half-step" : "Full-step",
+        margin_percent);
+    printf("%-18s %6s %8s %8s   %8s %10s\n", "profile", "min us", "accel ms", "decel ms", "moves s", "peak lag");
+
+    Candidate current_linear = {ACCEL_MIN_PERIOD_MICROS, ACCEL_TIME_MICROS, ACCEL_TIME_MICROS, Acceleration::RAMP_LINEAR};
+    Candidate current_s_curve = {S_CURVE_MIN_PERIOD_MICROS, S_CURVE_ACCEL_TIME_MICROS, S_CURVE_DECEL_TIME_MICROS,
+        Acceleration::RAMP_S_CURVE};
+    PrintResult("current linear", current_linear, tuner.Run(current_linear));
+    PrintResult("current s-curve", current_s_curve, tuner.Run(current_s_curve));
+
+    TrialResult linear_result;
+    TrialResult s_curve_result;
+    Candidate linear = Search(tuner, Acceleration::RAMP_LINEAR, max_period, linear_result);
+    Candidate s_curve = Search(tuner, Acceleration::RAMP_S_CURVE, max_period, s_curve_result);
+    if (!linear_result.ok || !s_curve_result.ok) {
+        fprintf(stderr, "\nNo ramp works with this model; try a smaller margin or a longer max period\n");
+        return 1;
+    }
+    PrintResult("tuned linear", linear, linear_result);
+    PrintResult("tuned s-curve", s_curve, s_curve_result);
+
+    printf("\nBuild flags for platformio.ini:\n\n");
+    printf("    ; Tuned by host/tuner/acceleration_tuner with a %.0f%% torque margin\n", margin_percent);
+    if ((uint16_t)max_period != ACCEL_MAX_PERIOD_MICROS) {
+        printf("    -DACCEL_MAX_PERIOD_MICROS=%u\n", (uint16_t)max_period);
+    }
+    printf("    -DACCEL_MIN_PERIOD_MICROS=%u\n", linear.min_period);
+    printf("    -DACCEL_TIME_MICROS=%u\n", linear.accel_time);
+    printf("    -DS_CURVE_MIN_PERIOD_MICROS=%u\n", s_curve.min_period);
+    printf("    -DS_CURVE_ACCEL_TIME_MICROS=%u\n", s_curve.accel_time);
+    printf("    -DS_CURVE_DECEL_TIME_MICROS=%u\n", s_curve.decel_time);
+    return 0;
+}
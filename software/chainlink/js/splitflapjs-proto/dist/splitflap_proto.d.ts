@@ -114,6 +114,22 @@ export namespace PB {
 
             /** ModuleState countMissedHome */
             countMissedHome?: (number|null);
+
+            /**
+             * Fastest acceleration step the module currently runs at. Each module learns this from its own home sensor
+             * errors, so it may be lower than the top of the acceleration profile.
+             */
+            maxAccelStep?: (number|null);
+
+            /**
+             * Estimated milliseconds until the module arrives at its target flap, based on its acceleration profile.
+             * 0 if the module is stopped, or if it can't know yet (e.g. while it's looking for home). Updated a few times
+             * per second while moving.
+             */
+            etaMillis?: (number|null);
+
+            /** What the module's motor coils are doing. Modules that are holding still draw current while stopped. */
+            coils?: (PB.SplitflapState.ModuleState.Coils|null);
         }
 
         /** Represents a ModuleState. */
@@ -143,6 +159,22 @@ export namespace PB {
             /** ModuleState countMissedHome. */
             public countMissedHome: number;
 
+            /**
+             * Fastest acceleration step the module currently runs at. Each module learns this from its own home sensor
+             * errors, so it may be lower than the top of the acceleration profile.
+             */
+            public maxAccelStep: number;
+
+            /**
+             * Estimated milliseconds until the module arrives at its target flap, based on its acceleration profile.
+             * 0 if the module is stopped, or if it can't know yet (e.g. while it's looking for home). Updated a few times
+             * per second while moving.
+             */
+            public etaMillis: number;
+
+            /** What the module's motor coils are doing. Modules that are holding still draw current while stopped. */
+            public coils: PB.SplitflapState.ModuleState.Coils;
+
             /**
              * Creates a new ModuleState instance using the specified properties.
              * @param [properties] Properties to set
@@ -224,6 +256,14 @@ export namespace PB {
                 PANIC = 3,
                 STATE_DISABLED = 4
             }
+
+            /** Coils enum. */
+            enum Coils {
+                OFF = 0,
+                STEPPING = 1,
+                SETTLING = 2,
+                PULSED_HOLD = 3
+            }
         }
     }
 
@@ -746,6 +786,108 @@ export namespace PB {
         }
     }
 
+    /** Properties of a MotionTrace. */
+    interface IMotionTrace {
+
+        /** MotionTrace module */
+        module?: (number|null);
+
+        /** MotionTrace events */
+        events?: (number[]|null);
+
+        /** MotionTrace stopped */
+        stopped?: (boolean|null);
+    }
+
+    /** Represents a MotionTrace. */
+    class MotionTrace implements IMotionTrace {
+
+        /**
+         * Constructs a new MotionTrace.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IMotionTrace);
+
+        /** MotionTrace module. */
+        public module: number;
+
+        /** MotionTrace events. */
+        public events: number[];
+
+        /** MotionTrace stopped. */
+        public stopped: boolean;
+
+        /**
+         * Creates a new MotionTrace instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns MotionTrace instance
+         */
+        public static create(properties?: PB.IMotionTrace): PB.MotionTrace;
+
+        /**
+         * Encodes the specified MotionTrace message. Does not implicitly {@link PB.MotionTrace.verify|verify} messages.
+         * @param message MotionTrace message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IMotionTrace, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified MotionTrace message, length delimited. Does not implicitly {@link PB.MotionTrace.verify|verify} messages.
+         * @param message MotionTrace message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IMotionTrace, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a MotionTrace message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns MotionTrace
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.MotionTrace;
+
+        /**
+         * Decodes a MotionTrace message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns MotionTrace
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.MotionTrace;
+
+        /**
+         * Verifies a MotionTrace message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a MotionTrace message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns MotionTrace
+         */
+        public static fromObject(object: { [k: string]: any }): PB.MotionTrace;
+
+        /**
+         * Creates a plain object from a MotionTrace message. Also converts values to other types if specified.
+         * @param message MotionTrace
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.MotionTrace, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this MotionTrace to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
     /** Properties of a FromSplitflap. */
     interface IFromSplitflap {
 
@@ -760,6 +902,9 @@ export namespace PB {
 
         /** FromSplitflap supervisorState */
         supervisorState?: (PB.ISupervisorState|null);
+
+        /** FromSplitflap motionTrace */
+        motionTrace?: (PB.IMotionTrace|null);
     }
 
     /** Represents a FromSplitflap. */
@@ -783,8 +928,11 @@ export namespace PB {
         /** FromSplitflap supervisorState. */
         public supervisorState?: (PB.ISupervisorState|null);
 
+        /** FromSplitflap motionTrace. */
+        public motionTrace?: (PB.IMotionTrace|null);
+
         /** FromSplitflap payload. */
-        public payload?: ("splitflapState"|"log"|"ack"|"supervisorState");
+        public payload?: ("splitflapState"|"log"|"ack"|"supervisorState"|"motionTrace");
 
         /**
          * Creates a new FromSplitflap instance using the specified properties.
@@ -862,6 +1010,20 @@ export namespace PB {
 
         /** SplitflapCommand modules */
         modules?: (PB.SplitflapCommand.IModuleCommand[]|null);
+
+        /**
+         * If true, modules going to a flap are started at staggered times, based on how long each one's move will take,
+         * so that they all arrive together rather than rippling into place. Modules that are already moving start
+         * immediately. If the firmware limits how many modules each power channel moves at once, modules that have to wait
+         * for their turn arrive late, so this is only best-effort when a move has more modules than that.
+         */
+        synchronizeArrival?: (boolean|null);
+
+        /**
+         * When synchronize_arrival is set, how far apart (in milliseconds) arrivals may be. Modules that would already
+         * arrive within this window of the last module aren't held back. 0 lands every module at once.
+         */
+        arrivalSpreadMillis?: (number|null);
     }
 
     /** Represents a SplitflapCommand. */
@@ -876,6 +1038,20 @@ export namespace PB {
         /** SplitflapCommand modules. */
         public modules: PB.SplitflapCommand.IModuleCommand[];
 
+        /**
+         * If true, modules going to a flap are started at staggered times, based on how long each one's move will take,
+         * so that they all arrive together rather than rippling into place. Modules that are already moving start
+         * immediately. If the firmware limits how many modules each power channel moves at once, modules that have to wait
+         * for their turn arrive late, so this is only best-effort when a move has more modules than that.
+         */
+        public synchronizeArrival: boolean;
+
+        /**
+         * When synchronize_arrival is set, how far apart (in milliseconds) arrivals may be. Modules that would already
+         * arrive within this window of the last module aren't held back. 0 lands every module at once.
+         */
+        public arrivalSpreadMillis: number;
+
         /**
          * Creates a new SplitflapCommand instance using the specified properties.
          * @param [properties] Properties to set
@@ -1051,7 +1227,8 @@ export namespace PB {
             enum Action {
                 NO_OP = 0,
                 GO_TO_FLAP = 1,
-                RESET_AND_HOME = 2
+                RESET_AND_HOME = 2,
+                CALIBRATE_HOME_OFFSET = 3
             }
         }
     }
@@ -1275,39 +1452,995 @@ export namespace PB {
         }
     }
 
-    /** Properties of a ToSplitflap. */
-    interface IToSplitflap {
+    /** Properties of a RequestState. */
+    interface IRequestState {
+    }
 
-        /** ToSplitflap nonce */
-        nonce?: (number|null);
+    /** Represents a RequestState. */
+    class RequestState implements IRequestState {
 
-        /** ToSplitflap splitflapCommand */
-        splitflapCommand?: (PB.ISplitflapCommand|null);
+        /**
+         * Constructs a new RequestState.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IRequestState);
 
-        /** ToSplitflap splitflapConfig */
-        splitflapConfig?: (PB.ISplitflapConfig|null);
+        /**
+         * Creates a new RequestState instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns RequestState instance
+         */
+        public static create(properties?: PB.IRequestState): PB.RequestState;
+
+        /**
+         * Encodes the specified RequestState message. Does not implicitly {@link PB.RequestState.verify|verify} messages.
+         * @param message RequestState message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IRequestState, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified RequestState message, length delimited. Does not implicitly {@link PB.RequestState.verify|verify} messages.
+         * @param message RequestState message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IRequestState, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a RequestState message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns RequestState
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.RequestState;
+
+        /**
+         * Decodes a RequestState message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns RequestState
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.RequestState;
+
+        /**
+         * Verifies a RequestState message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a RequestState message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns RequestState
+         */
+        public static fromObject(object: { [k: string]: any }): PB.RequestState;
+
+        /**
+         * Creates a plain object from a RequestState message. Also converts values to other types if specified.
+         * @param message RequestState
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.RequestState, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this RequestState to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
     }
 
-    /** Represents a ToSplitflap. */
-    class ToSplitflap implements IToSplitflap {
+    /** Properties of a RequestMotionTrace. */
+    interface IRequestMotionTrace {
+
+        /** RequestMotionTrace module */
+        module?: (number|null);
+    }
+
+    /** Represents a RequestMotionTrace. */
+    class RequestMotionTrace implements IRequestMotionTrace {
 
         /**
-         * Constructs a new ToSplitflap.
+         * Constructs a new RequestMotionTrace.
          * @param [properties] Properties to set
          */
-        constructor(properties?: PB.IToSplitflap);
+        constructor(properties?: PB.IRequestMotionTrace);
 
-        /** ToSplitflap nonce. */
-        public nonce: number;
+        /** RequestMotionTrace module. */
+        public module: number;
 
-        /** ToSplitflap splitflapCommand. */
-        public splitflapCommand?: (PB.ISplitflapCommand|null);
+        /**
+         * Creates a new RequestMotionTrace instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns RequestMotionTrace instance
+         */
+        public static create(properties?: PB.IRequestMotionTrace): PB.RequestMotionTrace;
 
-        /** ToSplitflap splitflapConfig. */
-        public splitflapConfig?: (PB.ISplitflapConfig|null);
+        /**
+         * Encodes the specified RequestMotionTrace message. Does not implicitly {@link PB.RequestMotionTrace.verify|verify} messages.
+         * @param message RequestMotionTrace message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IRequestMotionTrace, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified RequestMotionTrace message, length delimited. Does not implicitly {@link PB.RequestMotionTrace.verify|verify} messages.
+         * @param message RequestMotionTrace message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IRequestMotionTrace, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a RequestMotionTrace message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns RequestMotionTrace
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.RequestMotionTrace;
+
+        /**
+         * Decodes a RequestMotionTrace message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns RequestMotionTrace
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.RequestMotionTrace;
+
+        /**
+         * Verifies a RequestMotionTrace message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a RequestMotionTrace message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns RequestMotionTrace
+         */
+        public static fromObject(object: { [k: string]: any }): PB.RequestMotionTrace;
+
+        /**
+         * Creates a plain object from a RequestMotionTrace message. Also converts values to other types if specified.
+         * @param message RequestMotionTrace
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.RequestMotionTrace, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this RequestMotionTrace to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    /** Properties of an AccelerationProfile. */
+    interface IAccelerationProfile {
+
+        /**
+         * Step periods in microseconds, indexed by acceleration step. The first entry is the period used while idle, and
+         * the last entry is the top speed. Up to 320 entries, enough for the built-in S-curve ramp (261 entries when half
+         * stepping) with room to spare. The first period must be non-zero, and the rest no shorter than the firmware's
+         * MIN_PROFILE_STEP_PERIOD_MICROS.
+         */
+        accelStepPeriods?: (number[]|null);
+
+        /**
+         * Optional step periods to use while slowing down, indexed the same way as accel_step_periods (i.e. the second
+         * entry is the last step before stopping). Must be empty or the same length as accel_step_periods. If empty,
+         * deceleration mirrors accel_step_periods.
+         */
+        decelStepPeriods?: (number[]|null);
+    }
+
+    /** Represents an AccelerationProfile. */
+    class AccelerationProfile implements IAccelerationProfile {
+
+        /**
+         * Constructs a new AccelerationProfile.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IAccelerationProfile);
+
+        /**
+         * Step periods in microseconds, indexed by acceleration step. The first entry is the period used while idle, and
+         * the last entry is the top speed. Up to 320 entries, enough for the built-in S-curve ramp (261 entries when half
+         * stepping) with room to spare. The first period must be non-zero, and the rest no shorter than the firmware's
+         * MIN_PROFILE_STEP_PERIOD_MICROS.
+         */
+        public accelStepPeriods: number[];
+
+        /**
+         * Optional step periods to use while slowing down, indexed the same way as accel_step_periods (i.e. the second
+         * entry is the last step before stopping). Must be empty or the same length as accel_step_periods. If empty,
+         * deceleration mirrors accel_step_periods.
+         */
+        public decelStepPeriods: number[];
+
+        /**
+         * Creates a new AccelerationProfile instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns AccelerationProfile instance
+         */
+        public static create(properties?: PB.IAccelerationProfile): PB.AccelerationProfile;
+
+        /**
+         * Encodes the specified AccelerationProfile message. Does not implicitly {@link PB.AccelerationProfile.verify|verify} messages.
+         * @param message AccelerationProfile message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IAccelerationProfile, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified AccelerationProfile message, length delimited. Does not implicitly {@link PB.AccelerationProfile.verify|verify} messages.
+         * @param message AccelerationProfile message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IAccelerationProfile, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes an AccelerationProfile message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns AccelerationProfile
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.AccelerationProfile;
+
+        /**
+         * Decodes an AccelerationProfile message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns AccelerationProfile
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.AccelerationProfile;
+
+        /**
+         * Verifies an AccelerationProfile message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates an AccelerationProfile message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns AccelerationProfile
+         */
+        public static fromObject(object: { [k: string]: any }): PB.AccelerationProfile;
+
+        /**
+         * Creates a plain object from an AccelerationProfile message. Also converts values to other types if specified.
+         * @param message AccelerationProfile
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.AccelerationProfile, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this AccelerationProfile to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    /** Properties of a MotionConfig. */
+    interface IMotionConfig {
+
+        /**
+         * Replaces the acceleration profile used by every module. An empty accel_step_periods restores the
+         * profile built into the firmware. If unset, the current profile is left unchanged.
+         */
+        accelerationProfile?: (PB.IAccelerationProfile|null);
+
+        /**
+         * Per-module speed, as a percentage of the acceleration profile's speed (e.g. 50 for half speed). 0 leaves that
+         * module's speed unchanged.
+         *
+         * NOTE: Must be < 256
+         */
+        moduleSpeedPercent?: (number[]|null);
+
+        /** Per-module idle hold policy. Modules past the end of the list are left unchanged. */
+        moduleIdleHold?: (PB.MotionConfig.IIdleHold[]|null);
+    }
+
+    /** Represents a MotionConfig. */
+    class MotionConfig implements IMotionConfig {
+
+        /**
+         * Constructs a new MotionConfig.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IMotionConfig);
+
+        /**
+         * Replaces the acceleration profile used by every module. An empty accel_step_periods restores the
+         * profile built into the firmware. If unset, the current profile is left unchanged.
+         */
+        public accelerationProfile?: (PB.IAccelerationProfile|null);
+
+        /**
+         * Per-module speed, as a percentage of the acceleration profile's speed (e.g. 50 for half speed). 0 leaves that
+         * module's speed unchanged.
+         *
+         * NOTE: Must be < 256
+         */
+        public moduleSpeedPercent: number[];
+
+        /** Per-module idle hold policy. Modules past the end of the list are left unchanged. */
+        public moduleIdleHold: PB.MotionConfig.IIdleHold[];
+
+        /**
+         * Creates a new MotionConfig instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns MotionConfig instance
+         */
+        public static create(properties?: PB.IMotionConfig): PB.MotionConfig;
+
+        /**
+         * Encodes the specified MotionConfig message. Does not implicitly {@link PB.MotionConfig.verify|verify} messages.
+         * @param message MotionConfig message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IMotionConfig, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified MotionConfig message, length delimited. Does not implicitly {@link PB.MotionConfig.verify|verify} messages.
+         * @param message MotionConfig message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IMotionConfig, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a MotionConfig message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns MotionConfig
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.MotionConfig;
+
+        /**
+         * Decodes a MotionConfig message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns MotionConfig
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.MotionConfig;
+
+        /**
+         * Verifies a MotionConfig message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a MotionConfig message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns MotionConfig
+         */
+        public static fromObject(object: { [k: string]: any }): PB.MotionConfig;
+
+        /**
+         * Creates a plain object from a MotionConfig message. Also converts values to other types if specified.
+         * @param message MotionConfig
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.MotionConfig, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this MotionConfig to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    namespace MotionConfig {
+
+        /** Properties of an IdleHold. */
+        interface IIdleHold {
+
+            /** Milliseconds to keep the coils fully energized after arriving, so the flaps settle. */
+            settleMillis?: (number|null);
+
+            /**
+             * After settling, percent of the time to pulse the coils on for, which holds the motor in place with a fraction
+             * of the current. 0 releases the coils once settled.
+             */
+            holdPercent?: (number|null);
+
+            /** How long the pulsed hold lasts, in milliseconds. 65535 holds until the module next moves. */
+            holdMillis?: (number|null);
+        }
+
+        /**
+         * What a module does with its coils after each move. By default they're released straight away, which saves the
+         * most current and heat, but a spool with a lot of inertia can bounce back off its flap.
+         */
+        class IdleHold implements IIdleHold {
+
+            /**
+             * Constructs a new IdleHold.
+             * @param [properties] Properties to set
+             */
+            constructor(properties?: PB.MotionConfig.IIdleHold);
+
+            /** Milliseconds to keep the coils fully energized after arriving, so the flaps settle. */
+            public settleMillis: number;
+
+            /**
+             * After settling, percent of the time to pulse the coils on for, which holds the motor in place with a fraction
+             * of the current. 0 releases the coils once settled.
+             */
+            public holdPercent: number;
+
+            /** How long the pulsed hold lasts, in milliseconds. 65535 holds until the module next moves. */
+            public holdMillis: number;
+
+            /**
+             * Creates a new IdleHold instance using the specified properties.
+             * @param [properties] Properties to set
+             * @returns IdleHold instance
+             */
+            public static create(properties?: PB.MotionConfig.IIdleHold): PB.MotionConfig.IdleHold;
+
+            /**
+             * Encodes the specified IdleHold message. Does not implicitly {@link PB.MotionConfig.IdleHold.verify|verify} messages.
+             * @param message IdleHold message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encode(message: PB.MotionConfig.IIdleHold, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Encodes the specified IdleHold message, length delimited. Does not implicitly {@link PB.MotionConfig.IdleHold.verify|verify} messages.
+             * @param message IdleHold message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encodeDelimited(message: PB.MotionConfig.IIdleHold, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Decodes an IdleHold message from the specified reader or buffer.
+             * @param reader Reader or buffer to decode from
+             * @param [length] Message length if known beforehand
+             * @returns IdleHold
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.MotionConfig.IdleHold;
+
+            /**
+             * Decodes an IdleHold message from the specified reader or buffer, length delimited.
+             * @param reader Reader or buffer to decode from
+             * @returns IdleHold
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.MotionConfig.IdleHold;
+
+            /**
+             * Verifies an IdleHold message.
+             * @param message Plain object to verify
+             * @returns `null` if valid, otherwise the reason why it is not
+             */
+            public static verify(message: { [k: string]: any }): (string|null);
+
+            /**
+             * Creates an IdleHold message from a plain object. Also converts values to their respective internal types.
+             * @param object Plain object
+             * @returns IdleHold
+             */
+            public static fromObject(object: { [k: string]: any }): PB.MotionConfig.IdleHold;
+
+            /**
+             * Creates a plain object from an IdleHold message. Also converts values to other types if specified.
+             * @param message IdleHold
+             * @param [options] Conversion options
+             * @returns Plain object
+             */
+            public static toObject(message: PB.MotionConfig.IdleHold, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+            /**
+             * Converts this IdleHold to JSON.
+             * @returns JSON object
+             */
+            public toJSON(): { [k: string]: any };
+        }
+    }
+
+    /** Properties of a SplitflapSequence. */
+    interface ISplitflapSequence {
+
+        /**
+         * Frames are queued on each module and played back on the device: every module works through its own frames
+         * independently, as soon as it has finished the previous one. At most 8 frames can be queued per module.
+         */
+        frames?: (PB.SplitflapSequence.IFrame[]|null);
+
+        /** If true, frames are added after any frames still queued. Otherwise they replace them. */
+        append?: (boolean|null);
+    }
+
+    /** Represents a SplitflapSequence. */
+    class SplitflapSequence implements ISplitflapSequence {
+
+        /**
+         * Constructs a new SplitflapSequence.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.ISplitflapSequence);
+
+        /**
+         * Frames are queued on each module and played back on the device: every module works through its own frames
+         * independently, as soon as it has finished the previous one. At most 8 frames can be queued per module.
+         */
+        public frames: PB.SplitflapSequence.IFrame[];
+
+        /** If true, frames are added after any frames still queued. Otherwise they replace them. */
+        public append: boolean;
+
+        /**
+         * Creates a new SplitflapSequence instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns SplitflapSequence instance
+         */
+        public static create(properties?: PB.ISplitflapSequence): PB.SplitflapSequence;
+
+        /**
+         * Encodes the specified SplitflapSequence message. Does not implicitly {@link PB.SplitflapSequence.verify|verify} messages.
+         * @param message SplitflapSequence message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.ISplitflapSequence, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified SplitflapSequence message, length delimited. Does not implicitly {@link PB.SplitflapSequence.verify|verify} messages.
+         * @param message SplitflapSequence message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.ISplitflapSequence, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a SplitflapSequence message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns SplitflapSequence
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.SplitflapSequence;
+
+        /**
+         * Decodes a SplitflapSequence message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns SplitflapSequence
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.SplitflapSequence;
+
+        /**
+         * Verifies a SplitflapSequence message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a SplitflapSequence message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns SplitflapSequence
+         */
+        public static fromObject(object: { [k: string]: any }): PB.SplitflapSequence;
+
+        /**
+         * Creates a plain object from a SplitflapSequence message. Also converts values to other types if specified.
+         * @param message SplitflapSequence
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.SplitflapSequence, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this SplitflapSequence to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    namespace SplitflapSequence {
+
+        /** Properties of a Frame. */
+        interface IFrame {
+
+            /** Flap index for each module, or 255 to leave the module out of this frame. */
+            flapIndex?: (number[]|null);
+
+            /** How long each module waits after arriving at this frame's flap before moving on to its next frame. */
+            dwellMillis?: (number|null);
+        }
+
+        /** Represents a Frame. */
+        class Frame implements IFrame {
+
+            /**
+             * Constructs a new Frame.
+             * @param [properties] Properties to set
+             */
+            constructor(properties?: PB.SplitflapSequence.IFrame);
+
+            /** Flap index for each module, or 255 to leave the module out of this frame. */
+            public flapIndex: number[];
+
+            /** How long each module waits after arriving at this frame's flap before moving on to its next frame. */
+            public dwellMillis: number;
+
+            /**
+             * Creates a new Frame instance using the specified properties.
+             * @param [properties] Properties to set
+             * @returns Frame instance
+             */
+            public static create(properties?: PB.SplitflapSequence.IFrame): PB.SplitflapSequence.Frame;
+
+            /**
+             * Encodes the specified Frame message. Does not implicitly {@link PB.SplitflapSequence.Frame.verify|verify} messages.
+             * @param message Frame message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encode(message: PB.SplitflapSequence.IFrame, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Encodes the specified Frame message, length delimited. Does not implicitly {@link PB.SplitflapSequence.Frame.verify|verify} messages.
+             * @param message Frame message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encodeDelimited(message: PB.SplitflapSequence.IFrame, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Decodes a Frame message from the specified reader or buffer.
+             * @param reader Reader or buffer to decode from
+             * @param [length] Message length if known beforehand
+             * @returns Frame
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.SplitflapSequence.Frame;
+
+            /**
+             * Decodes a Frame message from the specified reader or buffer, length delimited.
+             * @param reader Reader or buffer to decode from
+             * @returns Frame
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.SplitflapSequence.Frame;
+
+            /**
+             * Verifies a Frame message.
+             * @param message Plain object to verify
+             * @returns `null` if valid, otherwise the reason why it is not
+             */
+            public static verify(message: { [k: string]: any }): (string|null);
+
+            /**
+             * Creates a Frame message from a plain object. Also converts values to their respective internal types.
+             * @param object Plain object
+             * @returns Frame
+             */
+            public static fromObject(object: { [k: string]: any }): PB.SplitflapSequence.Frame;
+
+            /**
+             * Creates a plain object from a Frame message. Also converts values to other types if specified.
+             * @param message Frame
+             * @param [options] Conversion options
+             * @returns Plain object
+             */
+            public static toObject(message: PB.SplitflapSequence.Frame, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+            /**
+             * Converts this Frame to JSON.
+             * @returns JSON object
+             */
+            public toJSON(): { [k: string]: any };
+        }
+    }
+
+    /** Properties of a FlapAlphabetConfig. */
+    interface IFlapAlphabetConfig {
+
+        /** Replaces the first alphabets (up to 4) with these. Alphabets that aren't sent are left unchanged. */
+        alphabets?: (PB.FlapAlphabetConfig.IAlphabet[]|null);
+
+        /**
+         * Index of the alphabet each module uses to map characters to flaps. If empty, modules keep their current
+         * alphabets.
+         *
+         * NOTE: Must be < 4
+         */
+        moduleAlphabet?: (number[]|null);
+    }
+
+    /** Represents a FlapAlphabetConfig. */
+    class FlapAlphabetConfig implements IFlapAlphabetConfig {
+
+        /**
+         * Constructs a new FlapAlphabetConfig.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IFlapAlphabetConfig);
+
+        /** Replaces the first alphabets (up to 4) with these. Alphabets that aren't sent are left unchanged. */
+        public alphabets: PB.FlapAlphabetConfig.IAlphabet[];
+
+        /**
+         * Index of the alphabet each module uses to map characters to flaps. If empty, modules keep their current
+         * alphabets.
+         *
+         * NOTE: Must be < 4
+         */
+        public moduleAlphabet: number[];
+
+        /**
+         * Creates a new FlapAlphabetConfig instance using the specified properties.
+         * @param [properties] Properties to set
+         * @returns FlapAlphabetConfig instance
+         */
+        public static create(properties?: PB.IFlapAlphabetConfig): PB.FlapAlphabetConfig;
+
+        /**
+         * Encodes the specified FlapAlphabetConfig message. Does not implicitly {@link PB.FlapAlphabetConfig.verify|verify} messages.
+         * @param message FlapAlphabetConfig message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encode(message: PB.IFlapAlphabetConfig, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Encodes the specified FlapAlphabetConfig message, length delimited. Does not implicitly {@link PB.FlapAlphabetConfig.verify|verify} messages.
+         * @param message FlapAlphabetConfig message or plain object to encode
+         * @param [writer] Writer to encode to
+         * @returns Writer
+         */
+        public static encodeDelimited(message: PB.IFlapAlphabetConfig, writer?: $protobuf.Writer): $protobuf.Writer;
+
+        /**
+         * Decodes a FlapAlphabetConfig message from the specified reader or buffer.
+         * @param reader Reader or buffer to decode from
+         * @param [length] Message length if known beforehand
+         * @returns FlapAlphabetConfig
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.FlapAlphabetConfig;
+
+        /**
+         * Decodes a FlapAlphabetConfig message from the specified reader or buffer, length delimited.
+         * @param reader Reader or buffer to decode from
+         * @returns FlapAlphabetConfig
+         * @throws {Error} If the payload is not a reader or valid buffer
+         * @throws {$protobuf.util.ProtocolError} If required fields are missing
+         */
+        public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.FlapAlphabetConfig;
+
+        /**
+         * Verifies a FlapAlphabetConfig message.
+         * @param message Plain object to verify
+         * @returns `null` if valid, otherwise the reason why it is not
+         */
+        public static verify(message: { [k: string]: any }): (string|null);
+
+        /**
+         * Creates a FlapAlphabetConfig message from a plain object. Also converts values to their respective internal types.
+         * @param object Plain object
+         * @returns FlapAlphabetConfig
+         */
+        public static fromObject(object: { [k: string]: any }): PB.FlapAlphabetConfig;
+
+        /**
+         * Creates a plain object from a FlapAlphabetConfig message. Also converts values to other types if specified.
+         * @param message FlapAlphabetConfig
+         * @param [options] Conversion options
+         * @returns Plain object
+         */
+        public static toObject(message: PB.FlapAlphabetConfig, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+        /**
+         * Converts this FlapAlphabetConfig to JSON.
+         * @returns JSON object
+         */
+        public toJSON(): { [k: string]: any };
+    }
+
+    namespace FlapAlphabetConfig {
+
+        /** Properties of an Alphabet. */
+        interface IAlphabet {
+
+            /**
+             * The characters on the flaps, as UTF-8, in spool order starting from the home flap. Must have exactly one
+             * character per flap.
+             */
+            flaps?: (string|null);
+        }
+
+        /** Represents an Alphabet. */
+        class Alphabet implements IAlphabet {
+
+            /**
+             * Constructs a new Alphabet.
+             * @param [properties] Properties to set
+             */
+            constructor(properties?: PB.FlapAlphabetConfig.IAlphabet);
+
+            /**
+             * The characters on the flaps, as UTF-8, in spool order starting from the home flap. Must have exactly one
+             * character per flap.
+             */
+            public flaps: string;
+
+            /**
+             * Creates a new Alphabet instance using the specified properties.
+             * @param [properties] Properties to set
+             * @returns Alphabet instance
+             */
+            public static create(properties?: PB.FlapAlphabetConfig.IAlphabet): PB.FlapAlphabetConfig.Alphabet;
+
+            /**
+             * Encodes the specified Alphabet message. Does not implicitly {@link PB.FlapAlphabetConfig.Alphabet.verify|verify} messages.
+             * @param message Alphabet message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encode(message: PB.FlapAlphabetConfig.IAlphabet, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Encodes the specified Alphabet message, length delimited. Does not implicitly {@link PB.FlapAlphabetConfig.Alphabet.verify|verify} messages.
+             * @param message Alphabet message or plain object to encode
+             * @param [writer] Writer to encode to
+             * @returns Writer
+             */
+            public static encodeDelimited(message: PB.FlapAlphabetConfig.IAlphabet, writer?: $protobuf.Writer): $protobuf.Writer;
+
+            /**
+             * Decodes an Alphabet message from the specified reader or buffer.
+             * @param reader Reader or buffer to decode from
+             * @param [length] Message length if known beforehand
+             * @returns Alphabet
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decode(reader: ($protobuf.Reader|Uint8Array), length?: number): PB.FlapAlphabetConfig.Alphabet;
+
+            /**
+             * Decodes an Alphabet message from the specified reader or buffer, length delimited.
+             * @param reader Reader or buffer to decode from
+             * @returns Alphabet
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            public static decodeDelimited(reader: ($protobuf.Reader|Uint8Array)): PB.FlapAlphabetConfig.Alphabet;
+
+            /**
+             * Verifies an Alphabet message.
+             * @param message Plain object to verify
+             * @returns `null` if valid, otherwise the reason why it is not
+             */
+            public static verify(message: { [k: string]: any }): (string|null);
+
+            /**
+             * Creates an Alphabet message from a plain object. Also converts values to their respective internal types.
+             * @param object Plain object
+             * @returns Alphabet
+             */
+            public static fromObject(object: { [k: string]: any }): PB.FlapAlphabetConfig.Alphabet;
+
+            /**
+             * Creates a plain object from an Alphabet message. Also converts values to other types if specified.
+             * @param message Alphabet
+             * @param [options] Conversion options
+             * @returns Plain object
+             */
+            public static toObject(message: PB.FlapAlphabetConfig.Alphabet, options?: $protobuf.IConversionOptions): { [k: string]: any };
+
+            /**
+             * Converts this Alphabet to JSON.
+             * @returns JSON object
+             */
+            public toJSON(): { [k: string]: any };
+        }
+    }
+
+    /** Properties of a ToSplitflap. */
+    interface IToSplitflap {
+
+        /** ToSplitflap nonce */
+        nonce?: (number|null);
+
+        /** ToSplitflap splitflapCommand */
+        splitflapCommand?: (PB.ISplitflapCommand|null);
+
+        /** ToSplitflap splitflapConfig */
+        splitflapConfig?: (PB.ISplitflapConfig|null);
+
+        /** ToSplitflap requestState */
+        requestState?: (PB.IRequestState|null);
+
+        /** ToSplitflap motionConfig */
+        motionConfig?: (PB.IMotionConfig|null);
+
+        /** ToSplitflap splitflapSequence */
+        splitflapSequence?: (PB.ISplitflapSequence|null);
+
+        /** ToSplitflap flapAlphabetConfig */
+        flapAlphabetConfig?: (PB.IFlapAlphabetConfig|null);
+
+        /** ToSplitflap requestMotionTrace */
+        requestMotionTrace?: (PB.IRequestMotionTrace|null);
+    }
+
+    /** Represents a ToSplitflap. */
+    class ToSplitflap implements IToSplitflap {
+
+        /**
+         * Constructs a new ToSplitflap.
+         * @param [properties] Properties to set
+         */
+        constructor(properties?: PB.IToSplitflap);
+
+        /** ToSplitflap nonce. */
+        public nonce: number;
+
+        /** ToSplitflap splitflapCommand. */
+        public splitflapCommand?: (PB.ISplitflapCommand|null);
+
+        /** ToSplitflap splitflapConfig. */
+        public splitflapConfig?: (PB.ISplitflapConfig|null);
+
+        /** ToSplitflap requestState. */
+        public requestState?: (PB.IRequestState|null);
+
+        /** ToSplitflap motionConfig. */
+        public motionConfig?: (PB.IMotionConfig|null);
+
+        /** ToSplitflap splitflapSequence. */
+        public splitflapSequence?: (PB.ISplitflapSequence|null);
+
+        /** ToSplitflap flapAlphabetConfig. */
+        public flapAlphabetConfig?: (PB.IFlapAlphabetConfig|null);
+
+        /** ToSplitflap requestMotionTrace. */
+        public requestMotionTrace?: (PB.IRequestMotionTrace|null);
 
         /** ToSplitflap payload. */
-        public payload?: ("splitflapCommand"|"splitflapConfig");
+        public payload?: ("splitflapCommand"|"splitflapConfig"|"requestState"|"motionConfig"|"splitflapSequence"|"flapAlphabetConfig"|"requestMotionTrace");
 
         /**
          * Creates a new ToSplitflap instance using the specified properties.
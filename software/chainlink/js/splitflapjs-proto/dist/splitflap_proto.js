@@ -242,6 +242,12 @@
                  * @property {boolean|null} [homeState] ModuleState homeState
                  * @property {number|null} [countUnexpectedHome] ModuleState countUnexpectedHome
                  * @property {number|null} [countMissedHome] ModuleState countMissedHome
+                 * @property {number|null} [maxAccelStep] Fastest acceleration step the module currently runs at. Each module learns this from its own home sensor
+                 * errors, so it may be lower than the top of the acceleration profile.
+                 * @property {number|null} [etaMillis] Estimated milliseconds until the module arrives at its target flap, based on its acceleration profile.
+                 * 0 if the module is stopped, or if it can't know yet (e.g. while it's looking for home). Updated a few times
+                 * per second while moving.
+                 * @property {PB.SplitflapState.ModuleState.Coils|null} [coils] What the module's motor coils are doing. Modules that are holding still draw current while stopped.
                  */
     
                 /**
@@ -307,6 +313,33 @@
                  */
                 ModuleState.prototype.countMissedHome = 0;
     
+                /**
+                 * Fastest acceleration step the module currently runs at. Each module learns this from its own home sensor
+                 * errors, so it may be lower than the top of the acceleration profile.
+                 * @member {number} maxAccelStep
+                 * @memberof PB.SplitflapState.ModuleState
+                 * @instance
+                 */
+                ModuleState.prototype.maxAccelStep = 0;
+    
+                /**
+                 * Estimated milliseconds until the module arrives at its target flap, based on its acceleration profile.
+                 * 0 if the module is stopped, or if it can't know yet (e.g. while it's looking for home). Updated a few times
+                 * per second while moving.
+                 * @member {number} etaMillis
+                 * @memberof PB.SplitflapState.ModuleState
+                 * @instance
+                 */
+                ModuleState.prototype.etaMillis = 0;
+    
+                /**
+                 * What the module's motor coils are doing. Modules that are holding still draw current while stopped.
+                 * @member {PB.SplitflapState.ModuleState.Coils} coils
+                 * @memberof PB.SplitflapState.ModuleState
+                 * @instance
+                 */
+                ModuleState.prototype.coils = 0;
+    
                 /**
                  * Creates a new ModuleState instance using the specified properties.
                  * @function create
@@ -343,6 +376,12 @@
                         writer.uint32(/* id 5, wireType 0 =*/40).uint32(message.countUnexpectedHome);
                     if (message.countMissedHome != null && Object.hasOwnProperty.call(message, "countMissedHome"))
                         writer.uint32(/* id 6, wireType 0 =*/48).uint32(message.countMissedHome);
+                    if (message.maxAccelStep != null && Object.hasOwnProperty.call(message, "maxAccelStep"))
+                        writer.uint32(/* id 7, wireType 0 =*/56).uint32(message.maxAccelStep);
+                    if (message.etaMillis != null && Object.hasOwnProperty.call(message, "etaMillis"))
+                        writer.uint32(/* id 8, wireType 0 =*/64).uint32(message.etaMillis);
+                    if (message.coils != null && Object.hasOwnProperty.call(message, "coils"))
+                        writer.uint32(/* id 9, wireType 0 =*/72).int32(message.coils);
                     return writer;
                 };
     
@@ -395,6 +434,15 @@
                         case 6:
                             message.countMissedHome = reader.uint32();
                             break;
+                        case 7:
+                            message.maxAccelStep = reader.uint32();
+                            break;
+                        case 8:
+                            message.etaMillis = reader.uint32();
+                            break;
+                        case 9:
+                            message.coils = reader.int32();
+                            break;
                         default:
                             reader.skipType(tag & 7);
                             break;
@@ -456,6 +504,22 @@
                     if (message.countMissedHome != null && message.hasOwnProperty("countMissedHome"))
                         if (!$util.isInteger(message.countMissedHome))
                             return "countMissedHome: integer expected";
+                    if (message.maxAccelStep != null && message.hasOwnProperty("maxAccelStep"))
+                        if (!$util.isInteger(message.maxAccelStep))
+                            return "maxAccelStep: integer expected";
+                    if (message.etaMillis != null && message.hasOwnProperty("etaMillis"))
+                        if (!$util.isInteger(message.etaMillis))
+                            return "etaMillis: integer expected";
+                    if (message.coils != null && message.hasOwnProperty("coils"))
+                        switch (message.coils) {
+                        default:
+                            return "coils: enum value expected";
+                        case 0:
+                        case 1:
+                        case 2:
+                        case 3:
+                            break;
+                        }
                     return null;
                 };
     
@@ -503,6 +567,28 @@
                         message.countUnexpectedHome = object.countUnexpectedHome >>> 0;
                     if (object.countMissedHome != null)
                         message.countMissedHome = object.countMissedHome >>> 0;
+                    if (object.maxAccelStep != null)
+                        message.maxAccelStep = object.maxAccelStep >>> 0;
+                    if (object.etaMillis != null)
+                        message.etaMillis = object.etaMillis >>> 0;
+                    switch (object.coils) {
+                    case "OFF":
+                    case 0:
+                        message.coils = 0;
+                        break;
+                    case "STEPPING":
+                    case 1:
+                        message.coils = 1;
+                        break;
+                    case "SETTLING":
+                    case 2:
+                        message.coils = 2;
+                        break;
+                    case "PULSED_HOLD":
+                    case 3:
+                        message.coils = 3;
+                        break;
+                    }
                     return message;
                 };
     
@@ -526,6 +612,9 @@
                         object.homeState = false;
                         object.countUnexpectedHome = 0;
                         object.countMissedHome = 0;
+                        object.maxAccelStep = 0;
+                        object.etaMillis = 0;
+                        object.coils = options.enums === String ? "OFF" : 0;
                     }
                     if (message.state != null && message.hasOwnProperty("state"))
                         object.state = options.enums === String ? $root.PB.SplitflapState.ModuleState.State[message.state] : message.state;
@@ -539,6 +628,12 @@
                         object.countUnexpectedHome = message.countUnexpectedHome;
                     if (message.countMissedHome != null && message.hasOwnProperty("countMissedHome"))
                         object.countMissedHome = message.countMissedHome;
+                    if (message.maxAccelStep != null && message.hasOwnProperty("maxAccelStep"))
+                        object.maxAccelStep = message.maxAccelStep;
+                    if (message.etaMillis != null && message.hasOwnProperty("etaMillis"))
+                        object.etaMillis = message.etaMillis;
+                    if (message.coils != null && message.hasOwnProperty("coils"))
+                        object.coils = options.enums === String ? $root.PB.SplitflapState.ModuleState.Coils[message.coils] : message.coils;
                     return object;
                 };
     
@@ -573,6 +668,24 @@
                     return values;
                 })();
     
+                /**
+                 * Coils enum.
+                 * @name PB.SplitflapState.ModuleState.Coils
+                 * @enum {number}
+                 * @property {number} OFF=0 OFF value
+                 * @property {number} STEPPING=1 STEPPING value
+                 * @property {number} SETTLING=2 SETTLING value
+                 * @property {number} PULSED_HOLD=3 PULSED_HOLD value
+                 */
+                ModuleState.Coils = (function() {
+                    var valuesById = {}, values = Object.create(valuesById);
+                    values[valuesById[0] = "OFF"] = 0;
+                    values[valuesById[1] = "STEPPING"] = 1;
+                    values[valuesById[2] = "SETTLING"] = 2;
+                    values[valuesById[3] = "PULSED_HOLD"] = 3;
+                    return values;
+                })();
+    
                 return ModuleState;
             })();
     
@@ -1815,6 +1928,263 @@
             return SupervisorState;
         })();
     
+        PB.MotionTrace = (function() {
+    
+            /**
+             * Properties of a MotionTrace.
+             * @memberof PB
+             * @interface IMotionTrace
+             * @property {number|null} [module] MotionTrace module
+             * @property {Array.<number>|null} [events] MotionTrace events
+             * @property {boolean|null} [stopped] MotionTrace stopped
+             */
+    
+            /**
+             * Constructs a new MotionTrace.
+             * @memberof PB
+             * @classdesc Represents a MotionTrace.
+             * @implements IMotionTrace
+             * @constructor
+             * @param {PB.IMotionTrace=} [properties] Properties to set
+             */
+            function MotionTrace(properties) {
+                this.events = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * MotionTrace module.
+             * @member {number} module
+             * @memberof PB.MotionTrace
+             * @instance
+             */
+            MotionTrace.prototype.module = 0;
+    
+            /**
+             * MotionTrace events.
+             * @member {Array.<number>} events
+             * @memberof PB.MotionTrace
+             * @instance
+             */
+            MotionTrace.prototype.events = $util.emptyArray;
+    
+            /**
+             * MotionTrace stopped.
+             * @member {boolean} stopped
+             * @memberof PB.MotionTrace
+             * @instance
+             */
+            MotionTrace.prototype.stopped = false;
+    
+            /**
+             * Creates a new MotionTrace instance using the specified properties.
+             * @function create
+             * @memberof PB.MotionTrace
+             * @static
+             * @param {PB.IMotionTrace=} [properties] Properties to set
+             * @returns {PB.MotionTrace} MotionTrace instance
+             */
+            MotionTrace.create = function create(properties) {
+                return new MotionTrace(properties);
+            };
+    
+            /**
+             * Encodes the specified MotionTrace message. Does not implicitly {@link PB.MotionTrace.verify|verify} messages.
+             * @function encode
+             * @memberof PB.MotionTrace
+             * @static
+             * @param {PB.IMotionTrace} message MotionTrace message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            MotionTrace.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.module != null && Object.hasOwnProperty.call(message, "module"))
+                    writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.module);
+                if (message.events != null && message.events.length) {
+                    writer.uint32(/* id 2, wireType 2 =*/18).fork();
+                    for (var i = 0; i < message.events.length; ++i)
+                        writer.fixed32(message.events[i]);
+                    writer.ldelim();
+                }
+                if (message.stopped != null && Object.hasOwnProperty.call(message, "stopped"))
+                    writer.uint32(/* id 3, wireType 0 =*/24).bool(message.stopped);
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified MotionTrace message, length delimited. Does not implicitly {@link PB.MotionTrace.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.MotionTrace
+             * @static
+             * @param {PB.IMotionTrace} message MotionTrace message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            MotionTrace.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a MotionTrace message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.MotionTrace
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.MotionTrace} MotionTrace
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            MotionTrace.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.MotionTrace();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        message.module = reader.uint32();
+                        break;
+                    case 2:
+                        if (!(message.events && message.events.length))
+                            message.events = [];
+                        if ((tag & 7) === 2) {
+                            var end2 = reader.uint32() + reader.pos;
+                            while (reader.pos < end2)
+                                message.events.push(reader.fixed32());
+                        } else
+                            message.events.push(reader.fixed32());
+                        break;
+                    case 3:
+                        message.stopped = reader.bool();
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a MotionTrace message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.MotionTrace
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.MotionTrace} MotionTrace
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            MotionTrace.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a MotionTrace message.
+             * @function verify
+             * @memberof PB.MotionTrace
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            MotionTrace.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.module != null && message.hasOwnProperty("module"))
+                    if (!$util.isInteger(message.module))
+                        return "module: integer expected";
+                if (message.events != null && message.hasOwnProperty("events")) {
+                    if (!Array.isArray(message.events))
+                        return "events: array expected";
+                    for (var i = 0; i < message.events.length; ++i)
+                        if (!$util.isInteger(message.events[i]))
+                            return "events: integer[] expected";
+                }
+                if (message.stopped != null && message.hasOwnProperty("stopped"))
+                    if (typeof message.stopped !== "boolean")
+                        return "stopped: boolean expected";
+                return null;
+            };
+    
+            /**
+             * Creates a MotionTrace message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.MotionTrace
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.MotionTrace} MotionTrace
+             */
+            MotionTrace.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.MotionTrace)
+                    return object;
+                var message = new $root.PB.MotionTrace();
+                if (object.module != null)
+                    message.module = object.module >>> 0;
+                if (object.events) {
+                    if (!Array.isArray(object.events))
+                        throw TypeError(".PB.MotionTrace.events: array expected");
+                    message.events = [];
+                    for (var i = 0; i < object.events.length; ++i)
+                        message.events[i] = object.events[i] >>> 0;
+                }
+                if (object.stopped != null)
+                    message.stopped = Boolean(object.stopped);
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a MotionTrace message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.MotionTrace
+             * @static
+             * @param {PB.MotionTrace} message MotionTrace
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            MotionTrace.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults)
+                    object.events = [];
+                if (options.defaults) {
+                    object.module = 0;
+                    object.stopped = false;
+                }
+                if (message.module != null && message.hasOwnProperty("module"))
+                    object.module = message.module;
+                if (message.events && message.events.length) {
+                    object.events = [];
+                    for (var j = 0; j < message.events.length; ++j)
+                        object.events[j] = message.events[j];
+                }
+                if (message.stopped != null && message.hasOwnProperty("stopped"))
+                    object.stopped = message.stopped;
+                return object;
+            };
+    
+            /**
+             * Converts this MotionTrace to JSON.
+             * @function toJSON
+             * @memberof PB.MotionTrace
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            MotionTrace.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            return MotionTrace;
+        })();
+    
         PB.FromSplitflap = (function() {
     
             /**
@@ -1825,6 +2195,7 @@
              * @property {PB.ILog|null} [log] FromSplitflap log
              * @property {PB.IAck|null} [ack] FromSplitflap ack
              * @property {PB.ISupervisorState|null} [supervisorState] FromSplitflap supervisorState
+             * @property {PB.IMotionTrace|null} [motionTrace] FromSplitflap motionTrace
              */
     
             /**
@@ -1874,17 +2245,25 @@
              */
             FromSplitflap.prototype.supervisorState = null;
     
+            /**
+             * FromSplitflap motionTrace.
+             * @member {PB.IMotionTrace|null|undefined} motionTrace
+             * @memberof PB.FromSplitflap
+             * @instance
+             */
+            FromSplitflap.prototype.motionTrace = null;
+    
             // OneOf field names bound to virtual getters and setters
             var $oneOfFields;
     
             /**
              * FromSplitflap payload.
-             * @member {"splitflapState"|"log"|"ack"|"supervisorState"|undefined} payload
+             * @member {"splitflapState"|"log"|"ack"|"supervisorState"|"motionTrace"|undefined} payload
              * @memberof PB.FromSplitflap
              * @instance
              */
             Object.defineProperty(FromSplitflap.prototype, "payload", {
-                get: $util.oneOfGetter($oneOfFields = ["splitflapState", "log", "ack", "supervisorState"]),
+                get: $util.oneOfGetter($oneOfFields = ["splitflapState", "log", "ack", "supervisorState", "motionTrace"]),
                 set: $util.oneOfSetter($oneOfFields)
             });
     
@@ -1920,6 +2299,8 @@
                     $root.PB.Ack.encode(message.ack, writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
                 if (message.supervisorState != null && Object.hasOwnProperty.call(message, "supervisorState"))
                     $root.PB.SupervisorState.encode(message.supervisorState, writer.uint32(/* id 4, wireType 2 =*/34).fork()).ldelim();
+                if (message.motionTrace != null && Object.hasOwnProperty.call(message, "motionTrace"))
+                    $root.PB.MotionTrace.encode(message.motionTrace, writer.uint32(/* id 5, wireType 2 =*/42).fork()).ldelim();
                 return writer;
             };
     
@@ -1966,6 +2347,9 @@
                     case 4:
                         message.supervisorState = $root.PB.SupervisorState.decode(reader, reader.uint32());
                         break;
+                    case 5:
+                        message.motionTrace = $root.PB.MotionTrace.decode(reader, reader.uint32());
+                        break;
                     default:
                         reader.skipType(tag & 7);
                         break;
@@ -2040,6 +2424,16 @@
                             return "supervisorState." + error;
                     }
                 }
+                if (message.motionTrace != null && message.hasOwnProperty("motionTrace")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.MotionTrace.verify(message.motionTrace);
+                        if (error)
+                            return "motionTrace." + error;
+                    }
+                }
                 return null;
             };
     
@@ -2075,6 +2469,11 @@
                         throw TypeError(".PB.FromSplitflap.supervisorState: object expected");
                     message.supervisorState = $root.PB.SupervisorState.fromObject(object.supervisorState);
                 }
+                if (object.motionTrace != null) {
+                    if (typeof object.motionTrace !== "object")
+                        throw TypeError(".PB.FromSplitflap.motionTrace: object expected");
+                    message.motionTrace = $root.PB.MotionTrace.fromObject(object.motionTrace);
+                }
                 return message;
             };
     
@@ -2111,6 +2510,11 @@
                     if (options.oneofs)
                         object.payload = "supervisorState";
                 }
+                if (message.motionTrace != null && message.hasOwnProperty("motionTrace")) {
+                    object.motionTrace = $root.PB.MotionTrace.toObject(message.motionTrace, options);
+                    if (options.oneofs)
+                        object.payload = "motionTrace";
+                }
                 return object;
             };
     
@@ -2135,6 +2539,12 @@
              * @memberof PB
              * @interface ISplitflapCommand
              * @property {Array.<PB.SplitflapCommand.IModuleCommand>|null} [modules] SplitflapCommand modules
+             * @property {boolean|null} [synchronizeArrival] If true, modules going to a flap are started at staggered times, based on how long each one's move will take,
+             * so that they all arrive together rather than rippling into place. Modules that are already moving start
+             * immediately. If the firmware limits how many modules each power channel moves at once, modules that have to wait
+             * for their turn arrive late, so this is only best-effort when a move has more modules than that.
+             * @property {number|null} [arrivalSpreadMillis] When synchronize_arrival is set, how far apart (in milliseconds) arrivals may be. Modules that would already
+             * arrive within this window of the last module aren't held back. 0 lands every module at once.
              */
     
             /**
@@ -2161,6 +2571,26 @@
              */
             SplitflapCommand.prototype.modules = $util.emptyArray;
     
+            /**
+             * If true, modules going to a flap are started at staggered times, based on how long each one's move will take,
+             * so that they all arrive together rather than rippling into place. Modules that are already moving start
+             * immediately. If the firmware limits how many modules each power channel moves at once, modules that have to wait
+             * for their turn arrive late, so this is only best-effort when a move has more modules than that.
+             * @member {boolean} synchronizeArrival
+             * @memberof PB.SplitflapCommand
+             * @instance
+             */
+            SplitflapCommand.prototype.synchronizeArrival = false;
+    
+            /**
+             * When synchronize_arrival is set, how far apart (in milliseconds) arrivals may be. Modules that would already
+             * arrive within this window of the last module aren't held back. 0 lands every module at once.
+             * @member {number} arrivalSpreadMillis
+             * @memberof PB.SplitflapCommand
+             * @instance
+             */
+            SplitflapCommand.prototype.arrivalSpreadMillis = 0;
+    
             /**
              * Creates a new SplitflapCommand instance using the specified properties.
              * @function create
@@ -2188,6 +2618,10 @@
                 if (message.modules != null && message.modules.length)
                     for (var i = 0; i < message.modules.length; ++i)
                         $root.PB.SplitflapCommand.ModuleCommand.encode(message.modules[i], writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
+                if (message.synchronizeArrival != null && Object.hasOwnProperty.call(message, "synchronizeArrival"))
+                    writer.uint32(/* id 3, wireType 0 =*/24).bool(message.synchronizeArrival);
+                if (message.arrivalSpreadMillis != null && Object.hasOwnProperty.call(message, "arrivalSpreadMillis"))
+                    writer.uint32(/* id 4, wireType 0 =*/32).uint32(message.arrivalSpreadMillis);
                 return writer;
             };
     
@@ -2227,6 +2661,12 @@
                             message.modules = [];
                         message.modules.push($root.PB.SplitflapCommand.ModuleCommand.decode(reader, reader.uint32()));
                         break;
+                    case 3:
+                        message.synchronizeArrival = reader.bool();
+                        break;
+                    case 4:
+                        message.arrivalSpreadMillis = reader.uint32();
+                        break;
                     default:
                         reader.skipType(tag & 7);
                         break;
@@ -2271,6 +2711,12 @@
                             return "modules." + error;
                     }
                 }
+                if (message.synchronizeArrival != null && message.hasOwnProperty("synchronizeArrival"))
+                    if (typeof message.synchronizeArrival !== "boolean")
+                        return "synchronizeArrival: boolean expected";
+                if (message.arrivalSpreadMillis != null && message.hasOwnProperty("arrivalSpreadMillis"))
+                    if (!$util.isInteger(message.arrivalSpreadMillis))
+                        return "arrivalSpreadMillis: integer expected";
                 return null;
             };
     
@@ -2296,6 +2742,10 @@
                         message.modules[i] = $root.PB.SplitflapCommand.ModuleCommand.fromObject(object.modules[i]);
                     }
                 }
+                if (object.synchronizeArrival != null)
+                    message.synchronizeArrival = Boolean(object.synchronizeArrival);
+                if (object.arrivalSpreadMillis != null)
+                    message.arrivalSpreadMillis = object.arrivalSpreadMillis >>> 0;
                 return message;
             };
     
@@ -2314,11 +2764,19 @@
                 var object = {};
                 if (options.arrays || options.defaults)
                     object.modules = [];
+                if (options.defaults) {
+                    object.synchronizeArrival = false;
+                    object.arrivalSpreadMillis = 0;
+                }
                 if (message.modules && message.modules.length) {
                     object.modules = [];
                     for (var j = 0; j < message.modules.length; ++j)
                         object.modules[j] = $root.PB.SplitflapCommand.ModuleCommand.toObject(message.modules[j], options);
                 }
+                if (message.synchronizeArrival != null && message.hasOwnProperty("synchronizeArrival"))
+                    object.synchronizeArrival = message.synchronizeArrival;
+                if (message.arrivalSpreadMillis != null && message.hasOwnProperty("arrivalSpreadMillis"))
+                    object.arrivalSpreadMillis = message.arrivalSpreadMillis;
                 return object;
             };
     
@@ -2484,6 +2942,7 @@
                         case 0:
                         case 1:
                         case 2:
+                        case 3:
                             break;
                         }
                     if (message.param != null && message.hasOwnProperty("param"))
@@ -2517,6 +2976,10 @@
                     case 2:
                         message.action = 2;
                         break;
+                    case "CALIBRATE_HOME_OFFSET":
+                    case 3:
+                        message.action = 3;
+                        break;
                     }
                     if (object.param != null)
                         message.param = object.param >>> 0;
@@ -2565,12 +3028,16 @@
                  * @property {number} NO_OP=0 NO_OP value
                  * @property {number} GO_TO_FLAP=1 GO_TO_FLAP value
                  * @property {number} RESET_AND_HOME=2 RESET_AND_HOME value
+                 * @property {number} CALIBRATE_HOME_OFFSET=3 Measures where the module's home sensor edge shows up over several revolutions, and centres its
+                 * home sensor checks there from then on. The module turns continuously until it's done. The result is
+                 * kept across reboots.
                  */
                 ModuleCommand.Action = (function() {
                     var valuesById = {}, values = Object.create(valuesById);
                     values[valuesById[0] = "NO_OP"] = 0;
                     values[valuesById[1] = "GO_TO_FLAP"] = 1;
                     values[valuesById[2] = "RESET_AND_HOME"] = 2;
+                    values[valuesById[3] = "CALIBRATE_HOME_OFFSET"] = 3;
                     return values;
                 })();
     
@@ -3036,26 +3503,23 @@
             return SplitflapConfig;
         })();
     
-        PB.ToSplitflap = (function() {
+        PB.RequestState = (function() {
     
             /**
-             * Properties of a ToSplitflap.
+             * Properties of a RequestState.
              * @memberof PB
-             * @interface IToSplitflap
-             * @property {number|null} [nonce] ToSplitflap nonce
-             * @property {PB.ISplitflapCommand|null} [splitflapCommand] ToSplitflap splitflapCommand
-             * @property {PB.ISplitflapConfig|null} [splitflapConfig] ToSplitflap splitflapConfig
+             * @interface IRequestState
              */
     
             /**
-             * Constructs a new ToSplitflap.
+             * Constructs a new RequestState.
              * @memberof PB
-             * @classdesc Represents a ToSplitflap.
-             * @implements IToSplitflap
+             * @classdesc Represents a RequestState.
+             * @implements IRequestState
              * @constructor
-             * @param {PB.IToSplitflap=} [properties] Properties to set
+             * @param {PB.IRequestState=} [properties] Properties to set
              */
-            function ToSplitflap(properties) {
+            function RequestState(properties) {
                 if (properties)
                     for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
                         if (properties[keys[i]] != null)
@@ -3063,40 +3527,2146 @@
             }
     
             /**
-             * ToSplitflap nonce.
-             * @member {number} nonce
-             * @memberof PB.ToSplitflap
-             * @instance
+             * Creates a new RequestState instance using the specified properties.
+             * @function create
+             * @memberof PB.RequestState
+             * @static
+             * @param {PB.IRequestState=} [properties] Properties to set
+             * @returns {PB.RequestState} RequestState instance
              */
-            ToSplitflap.prototype.nonce = 0;
+            RequestState.create = function create(properties) {
+                return new RequestState(properties);
+            };
     
             /**
-             * ToSplitflap splitflapCommand.
-             * @member {PB.ISplitflapCommand|null|undefined} splitflapCommand
-             * @memberof PB.ToSplitflap
-             * @instance
+             * Encodes the specified RequestState message. Does not implicitly {@link PB.RequestState.verify|verify} messages.
+             * @function encode
+             * @memberof PB.RequestState
+             * @static
+             * @param {PB.IRequestState} message RequestState message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
              */
-            ToSplitflap.prototype.splitflapCommand = null;
+            RequestState.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                return writer;
+            };
     
             /**
-             * ToSplitflap splitflapConfig.
-             * @member {PB.ISplitflapConfig|null|undefined} splitflapConfig
-             * @memberof PB.ToSplitflap
-             * @instance
-             */
-            ToSplitflap.prototype.splitflapConfig = null;
+             * Encodes the specified RequestState message, length delimited. Does not implicitly {@link PB.RequestState.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.RequestState
+             * @static
+             * @param {PB.IRequestState} message RequestState message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            RequestState.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a RequestState message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.RequestState
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.RequestState} RequestState
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            RequestState.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.RequestState();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a RequestState message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.RequestState
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.RequestState} RequestState
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            RequestState.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a RequestState message.
+             * @function verify
+             * @memberof PB.RequestState
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            RequestState.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                return null;
+            };
+    
+            /**
+             * Creates a RequestState message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.RequestState
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.RequestState} RequestState
+             */
+            RequestState.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.RequestState)
+                    return object;
+                return new $root.PB.RequestState();
+            };
+    
+            /**
+             * Creates a plain object from a RequestState message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.RequestState
+             * @static
+             * @param {PB.RequestState} message RequestState
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            RequestState.toObject = function toObject() {
+                return {};
+            };
+    
+            /**
+             * Converts this RequestState to JSON.
+             * @function toJSON
+             * @memberof PB.RequestState
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            RequestState.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            return RequestState;
+        })();
+    
+        PB.RequestMotionTrace = (function() {
+    
+            /**
+             * Properties of a RequestMotionTrace.
+             * @memberof PB
+             * @interface IRequestMotionTrace
+             * @property {number|null} [module] RequestMotionTrace module
+             */
+    
+            /**
+             * Constructs a new RequestMotionTrace.
+             * @memberof PB
+             * @classdesc Represents a RequestMotionTrace.
+             * @implements IRequestMotionTrace
+             * @constructor
+             * @param {PB.IRequestMotionTrace=} [properties] Properties to set
+             */
+            function RequestMotionTrace(properties) {
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * RequestMotionTrace module.
+             * @member {number} module
+             * @memberof PB.RequestMotionTrace
+             * @instance
+             */
+            RequestMotionTrace.prototype.module = 0;
+    
+            /**
+             * Creates a new RequestMotionTrace instance using the specified properties.
+             * @function create
+             * @memberof PB.RequestMotionTrace
+             * @static
+             * @param {PB.IRequestMotionTrace=} [properties] Properties to set
+             * @returns {PB.RequestMotionTrace} RequestMotionTrace instance
+             */
+            RequestMotionTrace.create = function create(properties) {
+                return new RequestMotionTrace(properties);
+            };
+    
+            /**
+             * Encodes the specified RequestMotionTrace message. Does not implicitly {@link PB.RequestMotionTrace.verify|verify} messages.
+             * @function encode
+             * @memberof PB.RequestMotionTrace
+             * @static
+             * @param {PB.IRequestMotionTrace} message RequestMotionTrace message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            RequestMotionTrace.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.module != null && Object.hasOwnProperty.call(message, "module"))
+                    writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.module);
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified RequestMotionTrace message, length delimited. Does not implicitly {@link PB.RequestMotionTrace.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.RequestMotionTrace
+             * @static
+             * @param {PB.IRequestMotionTrace} message RequestMotionTrace message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            RequestMotionTrace.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a RequestMotionTrace message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.RequestMotionTrace
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.RequestMotionTrace} RequestMotionTrace
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            RequestMotionTrace.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.RequestMotionTrace();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        message.module = reader.uint32();
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a RequestMotionTrace message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.RequestMotionTrace
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.RequestMotionTrace} RequestMotionTrace
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            RequestMotionTrace.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a RequestMotionTrace message.
+             * @function verify
+             * @memberof PB.RequestMotionTrace
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            RequestMotionTrace.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.module != null && message.hasOwnProperty("module"))
+                    if (!$util.isInteger(message.module))
+                        return "module: integer expected";
+                return null;
+            };
+    
+            /**
+             * Creates a RequestMotionTrace message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.RequestMotionTrace
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.RequestMotionTrace} RequestMotionTrace
+             */
+            RequestMotionTrace.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.RequestMotionTrace)
+                    return object;
+                var message = new $root.PB.RequestMotionTrace();
+                if (object.module != null)
+                    message.module = object.module >>> 0;
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a RequestMotionTrace message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.RequestMotionTrace
+             * @static
+             * @param {PB.RequestMotionTrace} message RequestMotionTrace
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            RequestMotionTrace.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.defaults)
+                    object.module = 0;
+                if (message.module != null && message.hasOwnProperty("module"))
+                    object.module = message.module;
+                return object;
+            };
+    
+            /**
+             * Converts this RequestMotionTrace to JSON.
+             * @function toJSON
+             * @memberof PB.RequestMotionTrace
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            RequestMotionTrace.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            return RequestMotionTrace;
+        })();
+    
+        PB.AccelerationProfile = (function() {
+    
+            /**
+             * Properties of an AccelerationProfile.
+             * @memberof PB
+             * @interface IAccelerationProfile
+             * @property {Array.<number>|null} [accelStepPeriods] Step periods in microseconds, indexed by acceleration step. The first entry is the period used while idle, and
+             * the last entry is the top speed. Up to 320 entries, enough for the built-in S-curve ramp (261 entries when half
+             * stepping) with room to spare. The first period must be non-zero, and the rest no shorter than the firmware's
+             * MIN_PROFILE_STEP_PERIOD_MICROS.
+             * @property {Array.<number>|null} [decelStepPeriods] Optional step periods to use while slowing down, indexed the same way as accel_step_periods (i.e. the second
+             * entry is the last step before stopping). Must be empty or the same length as accel_step_periods. If empty,
+             * deceleration mirrors accel_step_periods.
+             */
+    
+            /**
+             * Constructs a new AccelerationProfile.
+             * @memberof PB
+             * @classdesc Represents an AccelerationProfile.
+             * @implements IAccelerationProfile
+             * @constructor
+             * @param {PB.IAccelerationProfile=} [properties] Properties to set
+             */
+            function AccelerationProfile(properties) {
+                this.accelStepPeriods = [];
+                this.decelStepPeriods = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * Step periods in microseconds, indexed by acceleration step. The first entry is the period used while idle, and
+             * the last entry is the top speed. Up to 320 entries, enough for the built-in S-curve ramp (261 entries when half
+             * stepping) with room to spare. The first period must be non-zero, and the rest no shorter than the firmware's
+             * MIN_PROFILE_STEP_PERIOD_MICROS.
+             * @member {Array.<number>} accelStepPeriods
+             * @memberof PB.AccelerationProfile
+             * @instance
+             */
+            AccelerationProfile.prototype.accelStepPeriods = $util.emptyArray;
+    
+            /**
+             * Optional step periods to use while slowing down, indexed the same way as accel_step_periods (i.e. the second
+             * entry is the last step before stopping). Must be empty or the same length as accel_step_periods. If empty,
+             * deceleration mirrors accel_step_periods.
+             * @member {Array.<number>} decelStepPeriods
+             * @memberof PB.AccelerationProfile
+             * @instance
+             */
+            AccelerationProfile.prototype.decelStepPeriods = $util.emptyArray;
+    
+            /**
+             * Creates a new AccelerationProfile instance using the specified properties.
+             * @function create
+             * @memberof PB.AccelerationProfile
+             * @static
+             * @param {PB.IAccelerationProfile=} [properties] Properties to set
+             * @returns {PB.AccelerationProfile} AccelerationProfile instance
+             */
+            AccelerationProfile.create = function create(properties) {
+                return new AccelerationProfile(properties);
+            };
+    
+            /**
+             * Encodes the specified AccelerationProfile message. Does not implicitly {@link PB.AccelerationProfile.verify|verify} messages.
+             * @function encode
+             * @memberof PB.AccelerationProfile
+             * @static
+             * @param {PB.IAccelerationProfile} message AccelerationProfile message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            AccelerationProfile.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.accelStepPeriods != null && message.accelStepPeriods.length) {
+                    writer.uint32(/* id 1, wireType 2 =*/10).fork();
+                    for (var i = 0; i < message.accelStepPeriods.length; ++i)
+                        writer.uint32(message.accelStepPeriods[i]);
+                    writer.ldelim();
+                }
+                if (message.decelStepPeriods != null && message.decelStepPeriods.length) {
+                    writer.uint32(/* id 2, wireType 2 =*/18).fork();
+                    for (var i = 0; i < message.decelStepPeriods.length; ++i)
+                        writer.uint32(message.decelStepPeriods[i]);
+                    writer.ldelim();
+                }
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified AccelerationProfile message, length delimited. Does not implicitly {@link PB.AccelerationProfile.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.AccelerationProfile
+             * @static
+             * @param {PB.IAccelerationProfile} message AccelerationProfile message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            AccelerationProfile.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes an AccelerationProfile message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.AccelerationProfile
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.AccelerationProfile} AccelerationProfile
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            AccelerationProfile.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.AccelerationProfile();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        if (!(message.accelStepPeriods && message.accelStepPeriods.length))
+                            message.accelStepPeriods = [];
+                        if ((tag & 7) === 2) {
+                            var end2 = reader.uint32() + reader.pos;
+                            while (reader.pos < end2)
+                                message.accelStepPeriods.push(reader.uint32());
+                        } else
+                            message.accelStepPeriods.push(reader.uint32());
+                        break;
+                    case 2:
+                        if (!(message.decelStepPeriods && message.decelStepPeriods.length))
+                            message.decelStepPeriods = [];
+                        if ((tag & 7) === 2) {
+                            var end2 = reader.uint32() + reader.pos;
+                            while (reader.pos < end2)
+                                message.decelStepPeriods.push(reader.uint32());
+                        } else
+                            message.decelStepPeriods.push(reader.uint32());
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes an AccelerationProfile message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.AccelerationProfile
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.AccelerationProfile} AccelerationProfile
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            AccelerationProfile.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies an AccelerationProfile message.
+             * @function verify
+             * @memberof PB.AccelerationProfile
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            AccelerationProfile.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.accelStepPeriods != null && message.hasOwnProperty("accelStepPeriods")) {
+                    if (!Array.isArray(message.accelStepPeriods))
+                        return "accelStepPeriods: array expected";
+                    for (var i = 0; i < message.accelStepPeriods.length; ++i)
+                        if (!$util.isInteger(message.accelStepPeriods[i]))
+                            return "accelStepPeriods: integer[] expected";
+                }
+                if (message.decelStepPeriods != null && message.hasOwnProperty("decelStepPeriods")) {
+                    if (!Array.isArray(message.decelStepPeriods))
+                        return "decelStepPeriods: array expected";
+                    for (var i = 0; i < message.decelStepPeriods.length; ++i)
+                        if (!$util.isInteger(message.decelStepPeriods[i]))
+                            return "decelStepPeriods: integer[] expected";
+                }
+                return null;
+            };
+    
+            /**
+             * Creates an AccelerationProfile message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.AccelerationProfile
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.AccelerationProfile} AccelerationProfile
+             */
+            AccelerationProfile.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.AccelerationProfile)
+                    return object;
+                var message = new $root.PB.AccelerationProfile();
+                if (object.accelStepPeriods) {
+                    if (!Array.isArray(object.accelStepPeriods))
+                        throw TypeError(".PB.AccelerationProfile.accelStepPeriods: array expected");
+                    message.accelStepPeriods = [];
+                    for (var i = 0; i < object.accelStepPeriods.length; ++i)
+                        message.accelStepPeriods[i] = object.accelStepPeriods[i] >>> 0;
+                }
+                if (object.decelStepPeriods) {
+                    if (!Array.isArray(object.decelStepPeriods))
+                        throw TypeError(".PB.AccelerationProfile.decelStepPeriods: array expected");
+                    message.decelStepPeriods = [];
+                    for (var i = 0; i < object.decelStepPeriods.length; ++i)
+                        message.decelStepPeriods[i] = object.decelStepPeriods[i] >>> 0;
+                }
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from an AccelerationProfile message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.AccelerationProfile
+             * @static
+             * @param {PB.AccelerationProfile} message AccelerationProfile
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            AccelerationProfile.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults) {
+                    object.accelStepPeriods = [];
+                    object.decelStepPeriods = [];
+                }
+                if (message.accelStepPeriods && message.accelStepPeriods.length) {
+                    object.accelStepPeriods = [];
+                    for (var j = 0; j < message.accelStepPeriods.length; ++j)
+                        object.accelStepPeriods[j] = message.accelStepPeriods[j];
+                }
+                if (message.decelStepPeriods && message.decelStepPeriods.length) {
+                    object.decelStepPeriods = [];
+                    for (var j = 0; j < message.decelStepPeriods.length; ++j)
+                        object.decelStepPeriods[j] = message.decelStepPeriods[j];
+                }
+                return object;
+            };
+    
+            /**
+             * Converts this AccelerationProfile to JSON.
+             * @function toJSON
+             * @memberof PB.AccelerationProfile
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            AccelerationProfile.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            return AccelerationProfile;
+        })();
+    
+        PB.MotionConfig = (function() {
+    
+            /**
+             * Properties of a MotionConfig.
+             * @memberof PB
+             * @interface IMotionConfig
+             * @property {PB.IAccelerationProfile|null} [accelerationProfile] Replaces the acceleration profile used by every module. An empty accel_step_periods restores the
+             * profile built into the firmware. If unset, the current profile is left unchanged.
+             * @property {Array.<number>|null} [moduleSpeedPercent] Per-module speed, as a percentage of the acceleration profile's speed (e.g. 50 for half speed). 0 leaves that
+             * module's speed unchanged.
+             * 
+             * NOTE: Must be < 256
+             * @property {Array.<PB.MotionConfig.IIdleHold>|null} [moduleIdleHold] Per-module idle hold policy. Modules past the end of the list are left unchanged.
+             */
+    
+            /**
+             * Constructs a new MotionConfig.
+             * @memberof PB
+             * @classdesc Represents a MotionConfig.
+             * @implements IMotionConfig
+             * @constructor
+             * @param {PB.IMotionConfig=} [properties] Properties to set
+             */
+            function MotionConfig(properties) {
+                this.moduleSpeedPercent = [];
+                this.moduleIdleHold = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * Replaces the acceleration profile used by every module. An empty accel_step_periods restores the
+             * profile built into the firmware. If unset, the current profile is left unchanged.
+             * @member {PB.IAccelerationProfile|null|undefined} accelerationProfile
+             * @memberof PB.MotionConfig
+             * @instance
+             */
+            MotionConfig.prototype.accelerationProfile = null;
+    
+            /**
+             * Per-module speed, as a percentage of the acceleration profile's speed (e.g. 50 for half speed). 0 leaves that
+             * module's speed unchanged.
+             * 
+             * NOTE: Must be < 256
+             * @member {Array.<number>} moduleSpeedPercent
+             * @memberof PB.MotionConfig
+             * @instance
+             */
+            MotionConfig.prototype.moduleSpeedPercent = $util.emptyArray;
+    
+            /**
+             * Per-module idle hold policy. Modules past the end of the list are left unchanged.
+             * @member {Array.<PB.MotionConfig.IIdleHold>} moduleIdleHold
+             * @memberof PB.MotionConfig
+             * @instance
+             */
+            MotionConfig.prototype.moduleIdleHold = $util.emptyArray;
+    
+            /**
+             * Creates a new MotionConfig instance using the specified properties.
+             * @function create
+             * @memberof PB.MotionConfig
+             * @static
+             * @param {PB.IMotionConfig=} [properties] Properties to set
+             * @returns {PB.MotionConfig} MotionConfig instance
+             */
+            MotionConfig.create = function create(properties) {
+                return new MotionConfig(properties);
+            };
+    
+            /**
+             * Encodes the specified MotionConfig message. Does not implicitly {@link PB.MotionConfig.verify|verify} messages.
+             * @function encode
+             * @memberof PB.MotionConfig
+             * @static
+             * @param {PB.IMotionConfig} message MotionConfig message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            MotionConfig.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.accelerationProfile != null && Object.hasOwnProperty.call(message, "accelerationProfile"))
+                    $root.PB.AccelerationProfile.encode(message.accelerationProfile, writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                if (message.moduleSpeedPercent != null && message.moduleSpeedPercent.length) {
+                    writer.uint32(/* id 2, wireType 2 =*/18).fork();
+                    for (var i = 0; i < message.moduleSpeedPercent.length; ++i)
+                        writer.uint32(message.moduleSpeedPercent[i]);
+                    writer.ldelim();
+                }
+                if (message.moduleIdleHold != null && message.moduleIdleHold.length)
+                    for (var i = 0; i < message.moduleIdleHold.length; ++i)
+                        $root.PB.MotionConfig.IdleHold.encode(message.moduleIdleHold[i], writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified MotionConfig message, length delimited. Does not implicitly {@link PB.MotionConfig.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.MotionConfig
+             * @static
+             * @param {PB.IMotionConfig} message MotionConfig message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            MotionConfig.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a MotionConfig message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.MotionConfig
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.MotionConfig} MotionConfig
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            MotionConfig.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.MotionConfig();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        message.accelerationProfile = $root.PB.AccelerationProfile.decode(reader, reader.uint32());
+                        break;
+                    case 2:
+                        if (!(message.moduleSpeedPercent && message.moduleSpeedPercent.length))
+                            message.moduleSpeedPercent = [];
+                        if ((tag & 7) === 2) {
+                            var end2 = reader.uint32() + reader.pos;
+                            while (reader.pos < end2)
+                                message.moduleSpeedPercent.push(reader.uint32());
+                        } else
+                            message.moduleSpeedPercent.push(reader.uint32());
+                        break;
+                    case 3:
+                        if (!(message.moduleIdleHold && message.moduleIdleHold.length))
+                            message.moduleIdleHold = [];
+                        message.moduleIdleHold.push($root.PB.MotionConfig.IdleHold.decode(reader, reader.uint32()));
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a MotionConfig message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.MotionConfig
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.MotionConfig} MotionConfig
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            MotionConfig.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a MotionConfig message.
+             * @function verify
+             * @memberof PB.MotionConfig
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            MotionConfig.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.accelerationProfile != null && message.hasOwnProperty("accelerationProfile")) {
+                    var error = $root.PB.AccelerationProfile.verify(message.accelerationProfile);
+                    if (error)
+                        return "accelerationProfile." + error;
+                }
+                if (message.moduleSpeedPercent != null && message.hasOwnProperty("moduleSpeedPercent")) {
+                    if (!Array.isArray(message.moduleSpeedPercent))
+                        return "moduleSpeedPercent: array expected";
+                    for (var i = 0; i < message.moduleSpeedPercent.length; ++i)
+                        if (!$util.isInteger(message.moduleSpeedPercent[i]))
+                            return "moduleSpeedPercent: integer[] expected";
+                }
+                if (message.moduleIdleHold != null && message.hasOwnProperty("moduleIdleHold")) {
+                    if (!Array.isArray(message.moduleIdleHold))
+                        return "moduleIdleHold: array expected";
+                    for (var i = 0; i < message.moduleIdleHold.length; ++i) {
+                        var error = $root.PB.MotionConfig.IdleHold.verify(message.moduleIdleHold[i]);
+                        if (error)
+                            return "moduleIdleHold." + error;
+                    }
+                }
+                return null;
+            };
+    
+            /**
+             * Creates a MotionConfig message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.MotionConfig
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.MotionConfig} MotionConfig
+             */
+            MotionConfig.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.MotionConfig)
+                    return object;
+                var message = new $root.PB.MotionConfig();
+                if (object.accelerationProfile != null) {
+                    if (typeof object.accelerationProfile !== "object")
+                        throw TypeError(".PB.MotionConfig.accelerationProfile: object expected");
+                    message.accelerationProfile = $root.PB.AccelerationProfile.fromObject(object.accelerationProfile);
+                }
+                if (object.moduleSpeedPercent) {
+                    if (!Array.isArray(object.moduleSpeedPercent))
+                        throw TypeError(".PB.MotionConfig.moduleSpeedPercent: array expected");
+                    message.moduleSpeedPercent = [];
+                    for (var i = 0; i < object.moduleSpeedPercent.length; ++i)
+                        message.moduleSpeedPercent[i] = object.moduleSpeedPercent[i] >>> 0;
+                }
+                if (object.moduleIdleHold) {
+                    if (!Array.isArray(object.moduleIdleHold))
+                        throw TypeError(".PB.MotionConfig.moduleIdleHold: array expected");
+                    message.moduleIdleHold = [];
+                    for (var i = 0; i < object.moduleIdleHold.length; ++i) {
+                        if (typeof object.moduleIdleHold[i] !== "object")
+                            throw TypeError(".PB.MotionConfig.moduleIdleHold: object expected");
+                        message.moduleIdleHold[i] = $root.PB.MotionConfig.IdleHold.fromObject(object.moduleIdleHold[i]);
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a MotionConfig message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.MotionConfig
+             * @static
+             * @param {PB.MotionConfig} message MotionConfig
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            MotionConfig.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults) {
+                    object.moduleSpeedPercent = [];
+                    object.moduleIdleHold = [];
+                }
+                if (options.defaults)
+                    object.accelerationProfile = null;
+                if (message.accelerationProfile != null && message.hasOwnProperty("accelerationProfile"))
+                    object.accelerationProfile = $root.PB.AccelerationProfile.toObject(message.accelerationProfile, options);
+                if (message.moduleSpeedPercent && message.moduleSpeedPercent.length) {
+                    object.moduleSpeedPercent = [];
+                    for (var j = 0; j < message.moduleSpeedPercent.length; ++j)
+                        object.moduleSpeedPercent[j] = message.moduleSpeedPercent[j];
+                }
+                if (message.moduleIdleHold && message.moduleIdleHold.length) {
+                    object.moduleIdleHold = [];
+                    for (var j = 0; j < message.moduleIdleHold.length; ++j)
+                        object.moduleIdleHold[j] = $root.PB.MotionConfig.IdleHold.toObject(message.moduleIdleHold[j], options);
+                }
+                return object;
+            };
+    
+            /**
+             * Converts this MotionConfig to JSON.
+             * @function toJSON
+             * @memberof PB.MotionConfig
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            MotionConfig.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            MotionConfig.IdleHold = (function() {
+    
+                /**
+                 * Properties of an IdleHold.
+                 * @memberof PB.MotionConfig
+                 * @interface IIdleHold
+                 * @property {number|null} [settleMillis] Milliseconds to keep the coils fully energized after arriving, so the flaps settle.
+                 * @property {number|null} [holdPercent] After settling, percent of the time to pulse the coils on for, which holds the motor in place with a fraction
+                 * of the current. 0 releases the coils once settled.
+                 * @property {number|null} [holdMillis] How long the pulsed hold lasts, in milliseconds. 65535 holds until the module next moves.
+                 */
+    
+                /**
+                 * Constructs a new IdleHold.
+                 * @memberof PB.MotionConfig
+                 * @classdesc What a module does with its coils after each move. By default they're released straight away, which saves the
+                 * most current and heat, but a spool with a lot of inertia can bounce back off its flap.
+                 * @implements IIdleHold
+                 * @constructor
+                 * @param {PB.MotionConfig.IIdleHold=} [properties] Properties to set
+                 */
+                function IdleHold(properties) {
+                    if (properties)
+                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                            if (properties[keys[i]] != null)
+                                this[keys[i]] = properties[keys[i]];
+                }
+    
+                /**
+                 * Milliseconds to keep the coils fully energized after arriving, so the flaps settle.
+                 * @member {number} settleMillis
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @instance
+                 */
+                IdleHold.prototype.settleMillis = 0;
+    
+                /**
+                 * After settling, percent of the time to pulse the coils on for, which holds the motor in place with a fraction
+                 * of the current. 0 releases the coils once settled.
+                 * @member {number} holdPercent
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @instance
+                 */
+                IdleHold.prototype.holdPercent = 0;
+    
+                /**
+                 * How long the pulsed hold lasts, in milliseconds. 65535 holds until the module next moves.
+                 * @member {number} holdMillis
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @instance
+                 */
+                IdleHold.prototype.holdMillis = 0;
+    
+                /**
+                 * Creates a new IdleHold instance using the specified properties.
+                 * @function create
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @static
+                 * @param {PB.MotionConfig.IIdleHold=} [properties] Properties to set
+                 * @returns {PB.MotionConfig.IdleHold} IdleHold instance
+                 */
+                IdleHold.create = function create(properties) {
+                    return new IdleHold(properties);
+                };
+    
+                /**
+                 * Encodes the specified IdleHold message. Does not implicitly {@link PB.MotionConfig.IdleHold.verify|verify} messages.
+                 * @function encode
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @static
+                 * @param {PB.MotionConfig.IIdleHold} message IdleHold message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                IdleHold.encode = function encode(message, writer) {
+                    if (!writer)
+                        writer = $Writer.create();
+                    if (message.settleMillis != null && Object.hasOwnProperty.call(message, "settleMillis"))
+                        writer.uint32(/* id 1, wireType 0 =*/8).uint32(message.settleMillis);
+                    if (message.holdPercent != null && Object.hasOwnProperty.call(message, "holdPercent"))
+                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.holdPercent);
+                    if (message.holdMillis != null && Object.hasOwnProperty.call(message, "holdMillis"))
+                        writer.uint32(/* id 3, wireType 0 =*/24).uint32(message.holdMillis);
+                    return writer;
+                };
+    
+                /**
+                 * Encodes the specified IdleHold message, length delimited. Does not implicitly {@link PB.MotionConfig.IdleHold.verify|verify} messages.
+                 * @function encodeDelimited
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @static
+                 * @param {PB.MotionConfig.IIdleHold} message IdleHold message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                IdleHold.encodeDelimited = function encodeDelimited(message, writer) {
+                    return this.encode(message, writer).ldelim();
+                };
+    
+                /**
+                 * Decodes an IdleHold message from the specified reader or buffer.
+                 * @function decode
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @param {number} [length] Message length if known beforehand
+                 * @returns {PB.MotionConfig.IdleHold} IdleHold
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                IdleHold.decode = function decode(reader, length) {
+                    if (!(reader instanceof $Reader))
+                        reader = $Reader.create(reader);
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.MotionConfig.IdleHold();
+                    while (reader.pos < end) {
+                        var tag = reader.uint32();
+                        switch (tag >>> 3) {
+                        case 1:
+                            message.settleMillis = reader.uint32();
+                            break;
+                        case 2:
+                            message.holdPercent = reader.uint32();
+                            break;
+                        case 3:
+                            message.holdMillis = reader.uint32();
+                            break;
+                        default:
+                            reader.skipType(tag & 7);
+                            break;
+                        }
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Decodes an IdleHold message from the specified reader or buffer, length delimited.
+                 * @function decodeDelimited
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @returns {PB.MotionConfig.IdleHold} IdleHold
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                IdleHold.decodeDelimited = function decodeDelimited(reader) {
+                    if (!(reader instanceof $Reader))
+                        reader = new $Reader(reader);
+                    return this.decode(reader, reader.uint32());
+                };
+    
+                /**
+                 * Verifies an IdleHold message.
+                 * @function verify
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @static
+                 * @param {Object.<string,*>} message Plain object to verify
+                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                 */
+                IdleHold.verify = function verify(message) {
+                    if (typeof message !== "object" || message === null)
+                        return "object expected";
+                    if (message.settleMillis != null && message.hasOwnProperty("settleMillis"))
+                        if (!$util.isInteger(message.settleMillis))
+                            return "settleMillis: integer expected";
+                    if (message.holdPercent != null && message.hasOwnProperty("holdPercent"))
+                        if (!$util.isInteger(message.holdPercent))
+                            return "holdPercent: integer expected";
+                    if (message.holdMillis != null && message.hasOwnProperty("holdMillis"))
+                        if (!$util.isInteger(message.holdMillis))
+                            return "holdMillis: integer expected";
+                    return null;
+                };
+    
+                /**
+                 * Creates an IdleHold message from a plain object. Also converts values to their respective internal types.
+                 * @function fromObject
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @static
+                 * @param {Object.<string,*>} object Plain object
+                 * @returns {PB.MotionConfig.IdleHold} IdleHold
+                 */
+                IdleHold.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.MotionConfig.IdleHold)
+                        return object;
+                    var message = new $root.PB.MotionConfig.IdleHold();
+                    if (object.settleMillis != null)
+                        message.settleMillis = object.settleMillis >>> 0;
+                    if (object.holdPercent != null)
+                        message.holdPercent = object.holdPercent >>> 0;
+                    if (object.holdMillis != null)
+                        message.holdMillis = object.holdMillis >>> 0;
+                    return message;
+                };
+    
+                /**
+                 * Creates a plain object from an IdleHold message. Also converts values to other types if specified.
+                 * @function toObject
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @static
+                 * @param {PB.MotionConfig.IdleHold} message IdleHold
+                 * @param {$protobuf.IConversionOptions} [options] Conversion options
+                 * @returns {Object.<string,*>} Plain object
+                 */
+                IdleHold.toObject = function toObject(message, options) {
+                    if (!options)
+                        options = {};
+                    var object = {};
+                    if (options.defaults) {
+                        object.settleMillis = 0;
+                        object.holdPercent = 0;
+                        object.holdMillis = 0;
+                    }
+                    if (message.settleMillis != null && message.hasOwnProperty("settleMillis"))
+                        object.settleMillis = message.settleMillis;
+                    if (message.holdPercent != null && message.hasOwnProperty("holdPercent"))
+                        object.holdPercent = message.holdPercent;
+                    if (message.holdMillis != null && message.hasOwnProperty("holdMillis"))
+                        object.holdMillis = message.holdMillis;
+                    return object;
+                };
+    
+                /**
+                 * Converts this IdleHold to JSON.
+                 * @function toJSON
+                 * @memberof PB.MotionConfig.IdleHold
+                 * @instance
+                 * @returns {Object.<string,*>} JSON object
+                 */
+                IdleHold.prototype.toJSON = function toJSON() {
+                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                };
+    
+                return IdleHold;
+            })();
+    
+            return MotionConfig;
+        })();
+    
+        PB.SplitflapSequence = (function() {
+    
+            /**
+             * Properties of a SplitflapSequence.
+             * @memberof PB
+             * @interface ISplitflapSequence
+             * @property {Array.<PB.SplitflapSequence.IFrame>|null} [frames] Frames are queued on each module and played back on the device: every module works through its own frames
+             * independently, as soon as it has finished the previous one. At most 8 frames can be queued per module.
+             * @property {boolean|null} [append] If true, frames are added after any frames still queued. Otherwise they replace them.
+             */
+    
+            /**
+             * Constructs a new SplitflapSequence.
+             * @memberof PB
+             * @classdesc Represents a SplitflapSequence.
+             * @implements ISplitflapSequence
+             * @constructor
+             * @param {PB.ISplitflapSequence=} [properties] Properties to set
+             */
+            function SplitflapSequence(properties) {
+                this.frames = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * Frames are queued on each module and played back on the device: every module works through its own frames
+             * independently, as soon as it has finished the previous one. At most 8 frames can be queued per module.
+             * @member {Array.<PB.SplitflapSequence.IFrame>} frames
+             * @memberof PB.SplitflapSequence
+             * @instance
+             */
+            SplitflapSequence.prototype.frames = $util.emptyArray;
+    
+            /**
+             * If true, frames are added after any frames still queued. Otherwise they replace them.
+             * @member {boolean} append
+             * @memberof PB.SplitflapSequence
+             * @instance
+             */
+            SplitflapSequence.prototype.append = false;
+    
+            /**
+             * Creates a new SplitflapSequence instance using the specified properties.
+             * @function create
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {PB.ISplitflapSequence=} [properties] Properties to set
+             * @returns {PB.SplitflapSequence} SplitflapSequence instance
+             */
+            SplitflapSequence.create = function create(properties) {
+                return new SplitflapSequence(properties);
+            };
+    
+            /**
+             * Encodes the specified SplitflapSequence message. Does not implicitly {@link PB.SplitflapSequence.verify|verify} messages.
+             * @function encode
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {PB.ISplitflapSequence} message SplitflapSequence message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapSequence.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.frames != null && message.frames.length)
+                    for (var i = 0; i < message.frames.length; ++i)
+                        $root.PB.SplitflapSequence.Frame.encode(message.frames[i], writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                if (message.append != null && Object.hasOwnProperty.call(message, "append"))
+                    writer.uint32(/* id 2, wireType 0 =*/16).bool(message.append);
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified SplitflapSequence message, length delimited. Does not implicitly {@link PB.SplitflapSequence.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {PB.ISplitflapSequence} message SplitflapSequence message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            SplitflapSequence.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a SplitflapSequence message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.SplitflapSequence} SplitflapSequence
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapSequence.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapSequence();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        if (!(message.frames && message.frames.length))
+                            message.frames = [];
+                        message.frames.push($root.PB.SplitflapSequence.Frame.decode(reader, reader.uint32()));
+                        break;
+                    case 2:
+                        message.append = reader.bool();
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a SplitflapSequence message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.SplitflapSequence} SplitflapSequence
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            SplitflapSequence.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a SplitflapSequence message.
+             * @function verify
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            SplitflapSequence.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.frames != null && message.hasOwnProperty("frames")) {
+                    if (!Array.isArray(message.frames))
+                        return "frames: array expected";
+                    for (var i = 0; i < message.frames.length; ++i) {
+                        var error = $root.PB.SplitflapSequence.Frame.verify(message.frames[i]);
+                        if (error)
+                            return "frames." + error;
+                    }
+                }
+                if (message.append != null && message.hasOwnProperty("append"))
+                    if (typeof message.append !== "boolean")
+                        return "append: boolean expected";
+                return null;
+            };
+    
+            /**
+             * Creates a SplitflapSequence message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.SplitflapSequence} SplitflapSequence
+             */
+            SplitflapSequence.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.SplitflapSequence)
+                    return object;
+                var message = new $root.PB.SplitflapSequence();
+                if (object.frames) {
+                    if (!Array.isArray(object.frames))
+                        throw TypeError(".PB.SplitflapSequence.frames: array expected");
+                    message.frames = [];
+                    for (var i = 0; i < object.frames.length; ++i) {
+                        if (typeof object.frames[i] !== "object")
+                            throw TypeError(".PB.SplitflapSequence.frames: object expected");
+                        message.frames[i] = $root.PB.SplitflapSequence.Frame.fromObject(object.frames[i]);
+                    }
+                }
+                if (object.append != null)
+                    message.append = Boolean(object.append);
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a SplitflapSequence message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.SplitflapSequence
+             * @static
+             * @param {PB.SplitflapSequence} message SplitflapSequence
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            SplitflapSequence.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults)
+                    object.frames = [];
+                if (options.defaults)
+                    object.append = false;
+                if (message.frames && message.frames.length) {
+                    object.frames = [];
+                    for (var j = 0; j < message.frames.length; ++j)
+                        object.frames[j] = $root.PB.SplitflapSequence.Frame.toObject(message.frames[j], options);
+                }
+                if (message.append != null && message.hasOwnProperty("append"))
+                    object.append = message.append;
+                return object;
+            };
+    
+            /**
+             * Converts this SplitflapSequence to JSON.
+             * @function toJSON
+             * @memberof PB.SplitflapSequence
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            SplitflapSequence.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            SplitflapSequence.Frame = (function() {
+    
+                /**
+                 * Properties of a Frame.
+                 * @memberof PB.SplitflapSequence
+                 * @interface IFrame
+                 * @property {Array.<number>|null} [flapIndex] Flap index for each module, or 255 to leave the module out of this frame.
+                 * @property {number|null} [dwellMillis] How long each module waits after arriving at this frame's flap before moving on to its next frame.
+                 */
+    
+                /**
+                 * Constructs a new Frame.
+                 * @memberof PB.SplitflapSequence
+                 * @classdesc Represents a Frame.
+                 * @implements IFrame
+                 * @constructor
+                 * @param {PB.SplitflapSequence.IFrame=} [properties] Properties to set
+                 */
+                function Frame(properties) {
+                    this.flapIndex = [];
+                    if (properties)
+                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                            if (properties[keys[i]] != null)
+                                this[keys[i]] = properties[keys[i]];
+                }
+    
+                /**
+                 * Flap index for each module, or 255 to leave the module out of this frame.
+                 * @member {Array.<number>} flapIndex
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @instance
+                 */
+                Frame.prototype.flapIndex = $util.emptyArray;
+    
+                /**
+                 * How long each module waits after arriving at this frame's flap before moving on to its next frame.
+                 * @member {number} dwellMillis
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @instance
+                 */
+                Frame.prototype.dwellMillis = 0;
+    
+                /**
+                 * Creates a new Frame instance using the specified properties.
+                 * @function create
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @static
+                 * @param {PB.SplitflapSequence.IFrame=} [properties] Properties to set
+                 * @returns {PB.SplitflapSequence.Frame} Frame instance
+                 */
+                Frame.create = function create(properties) {
+                    return new Frame(properties);
+                };
+    
+                /**
+                 * Encodes the specified Frame message. Does not implicitly {@link PB.SplitflapSequence.Frame.verify|verify} messages.
+                 * @function encode
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @static
+                 * @param {PB.SplitflapSequence.IFrame} message Frame message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                Frame.encode = function encode(message, writer) {
+                    if (!writer)
+                        writer = $Writer.create();
+                    if (message.flapIndex != null && message.flapIndex.length) {
+                        writer.uint32(/* id 1, wireType 2 =*/10).fork();
+                        for (var i = 0; i < message.flapIndex.length; ++i)
+                            writer.uint32(message.flapIndex[i]);
+                        writer.ldelim();
+                    }
+                    if (message.dwellMillis != null && Object.hasOwnProperty.call(message, "dwellMillis"))
+                        writer.uint32(/* id 2, wireType 0 =*/16).uint32(message.dwellMillis);
+                    return writer;
+                };
+    
+                /**
+                 * Encodes the specified Frame message, length delimited. Does not implicitly {@link PB.SplitflapSequence.Frame.verify|verify} messages.
+                 * @function encodeDelimited
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @static
+                 * @param {PB.SplitflapSequence.IFrame} message Frame message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                Frame.encodeDelimited = function encodeDelimited(message, writer) {
+                    return this.encode(message, writer).ldelim();
+                };
+    
+                /**
+                 * Decodes a Frame message from the specified reader or buffer.
+                 * @function decode
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @param {number} [length] Message length if known beforehand
+                 * @returns {PB.SplitflapSequence.Frame} Frame
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                Frame.decode = function decode(reader, length) {
+                    if (!(reader instanceof $Reader))
+                        reader = $Reader.create(reader);
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.SplitflapSequence.Frame();
+                    while (reader.pos < end) {
+                        var tag = reader.uint32();
+                        switch (tag >>> 3) {
+                        case 1:
+                            if (!(message.flapIndex && message.flapIndex.length))
+                                message.flapIndex = [];
+                            if ((tag & 7) === 2) {
+                                var end2 = reader.uint32() + reader.pos;
+                                while (reader.pos < end2)
+                                    message.flapIndex.push(reader.uint32());
+                            } else
+                                message.flapIndex.push(reader.uint32());
+                            break;
+                        case 2:
+                            message.dwellMillis = reader.uint32();
+                            break;
+                        default:
+                            reader.skipType(tag & 7);
+                            break;
+                        }
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Decodes a Frame message from the specified reader or buffer, length delimited.
+                 * @function decodeDelimited
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @returns {PB.SplitflapSequence.Frame} Frame
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                Frame.decodeDelimited = function decodeDelimited(reader) {
+                    if (!(reader instanceof $Reader))
+                        reader = new $Reader(reader);
+                    return this.decode(reader, reader.uint32());
+                };
+    
+                /**
+                 * Verifies a Frame message.
+                 * @function verify
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @static
+                 * @param {Object.<string,*>} message Plain object to verify
+                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                 */
+                Frame.verify = function verify(message) {
+                    if (typeof message !== "object" || message === null)
+                        return "object expected";
+                    if (message.flapIndex != null && message.hasOwnProperty("flapIndex")) {
+                        if (!Array.isArray(message.flapIndex))
+                            return "flapIndex: array expected";
+                        for (var i = 0; i < message.flapIndex.length; ++i)
+                            if (!$util.isInteger(message.flapIndex[i]))
+                                return "flapIndex: integer[] expected";
+                    }
+                    if (message.dwellMillis != null && message.hasOwnProperty("dwellMillis"))
+                        if (!$util.isInteger(message.dwellMillis))
+                            return "dwellMillis: integer expected";
+                    return null;
+                };
+    
+                /**
+                 * Creates a Frame message from a plain object. Also converts values to their respective internal types.
+                 * @function fromObject
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @static
+                 * @param {Object.<string,*>} object Plain object
+                 * @returns {PB.SplitflapSequence.Frame} Frame
+                 */
+                Frame.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.SplitflapSequence.Frame)
+                        return object;
+                    var message = new $root.PB.SplitflapSequence.Frame();
+                    if (object.flapIndex) {
+                        if (!Array.isArray(object.flapIndex))
+                            throw TypeError(".PB.SplitflapSequence.Frame.flapIndex: array expected");
+                        message.flapIndex = [];
+                        for (var i = 0; i < object.flapIndex.length; ++i)
+                            message.flapIndex[i] = object.flapIndex[i] >>> 0;
+                    }
+                    if (object.dwellMillis != null)
+                        message.dwellMillis = object.dwellMillis >>> 0;
+                    return message;
+                };
+    
+                /**
+                 * Creates a plain object from a Frame message. Also converts values to other types if specified.
+                 * @function toObject
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @static
+                 * @param {PB.SplitflapSequence.Frame} message Frame
+                 * @param {$protobuf.IConversionOptions} [options] Conversion options
+                 * @returns {Object.<string,*>} Plain object
+                 */
+                Frame.toObject = function toObject(message, options) {
+                    if (!options)
+                        options = {};
+                    var object = {};
+                    if (options.arrays || options.defaults)
+                        object.flapIndex = [];
+                    if (options.defaults)
+                        object.dwellMillis = 0;
+                    if (message.flapIndex && message.flapIndex.length) {
+                        object.flapIndex = [];
+                        for (var j = 0; j < message.flapIndex.length; ++j)
+                            object.flapIndex[j] = message.flapIndex[j];
+                    }
+                    if (message.dwellMillis != null && message.hasOwnProperty("dwellMillis"))
+                        object.dwellMillis = message.dwellMillis;
+                    return object;
+                };
+    
+                /**
+                 * Converts this Frame to JSON.
+                 * @function toJSON
+                 * @memberof PB.SplitflapSequence.Frame
+                 * @instance
+                 * @returns {Object.<string,*>} JSON object
+                 */
+                Frame.prototype.toJSON = function toJSON() {
+                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                };
+    
+                return Frame;
+            })();
+    
+            return SplitflapSequence;
+        })();
+    
+        PB.FlapAlphabetConfig = (function() {
+    
+            /**
+             * Properties of a FlapAlphabetConfig.
+             * @memberof PB
+             * @interface IFlapAlphabetConfig
+             * @property {Array.<PB.FlapAlphabetConfig.IAlphabet>|null} [alphabets] Replaces the first alphabets (up to 4) with these. Alphabets that aren't sent are left unchanged.
+             * @property {Array.<number>|null} [moduleAlphabet] Index of the alphabet each module uses to map characters to flaps. If empty, modules keep their current
+             * alphabets.
+             * 
+             * NOTE: Must be < 4
+             */
+    
+            /**
+             * Constructs a new FlapAlphabetConfig.
+             * @memberof PB
+             * @classdesc Represents a FlapAlphabetConfig.
+             * @implements IFlapAlphabetConfig
+             * @constructor
+             * @param {PB.IFlapAlphabetConfig=} [properties] Properties to set
+             */
+            function FlapAlphabetConfig(properties) {
+                this.alphabets = [];
+                this.moduleAlphabet = [];
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * Replaces the first alphabets (up to 4) with these. Alphabets that aren't sent are left unchanged.
+             * @member {Array.<PB.FlapAlphabetConfig.IAlphabet>} alphabets
+             * @memberof PB.FlapAlphabetConfig
+             * @instance
+             */
+            FlapAlphabetConfig.prototype.alphabets = $util.emptyArray;
+    
+            /**
+             * Index of the alphabet each module uses to map characters to flaps. If empty, modules keep their current
+             * alphabets.
+             * 
+             * NOTE: Must be < 4
+             * @member {Array.<number>} moduleAlphabet
+             * @memberof PB.FlapAlphabetConfig
+             * @instance
+             */
+            FlapAlphabetConfig.prototype.moduleAlphabet = $util.emptyArray;
+    
+            /**
+             * Creates a new FlapAlphabetConfig instance using the specified properties.
+             * @function create
+             * @memberof PB.FlapAlphabetConfig
+             * @static
+             * @param {PB.IFlapAlphabetConfig=} [properties] Properties to set
+             * @returns {PB.FlapAlphabetConfig} FlapAlphabetConfig instance
+             */
+            FlapAlphabetConfig.create = function create(properties) {
+                return new FlapAlphabetConfig(properties);
+            };
+    
+            /**
+             * Encodes the specified FlapAlphabetConfig message. Does not implicitly {@link PB.FlapAlphabetConfig.verify|verify} messages.
+             * @function encode
+             * @memberof PB.FlapAlphabetConfig
+             * @static
+             * @param {PB.IFlapAlphabetConfig} message FlapAlphabetConfig message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            FlapAlphabetConfig.encode = function encode(message, writer) {
+                if (!writer)
+                    writer = $Writer.create();
+                if (message.alphabets != null && message.alphabets.length)
+                    for (var i = 0; i < message.alphabets.length; ++i)
+                        $root.PB.FlapAlphabetConfig.Alphabet.encode(message.alphabets[i], writer.uint32(/* id 1, wireType 2 =*/10).fork()).ldelim();
+                if (message.moduleAlphabet != null && message.moduleAlphabet.length) {
+                    writer.uint32(/* id 2, wireType 2 =*/18).fork();
+                    for (var i = 0; i < message.moduleAlphabet.length; ++i)
+                        writer.uint32(message.moduleAlphabet[i]);
+                    writer.ldelim();
+                }
+                return writer;
+            };
+    
+            /**
+             * Encodes the specified FlapAlphabetConfig message, length delimited. Does not implicitly {@link PB.FlapAlphabetConfig.verify|verify} messages.
+             * @function encodeDelimited
+             * @memberof PB.FlapAlphabetConfig
+             * @static
+             * @param {PB.IFlapAlphabetConfig} message FlapAlphabetConfig message or plain object to encode
+             * @param {$protobuf.Writer} [writer] Writer to encode to
+             * @returns {$protobuf.Writer} Writer
+             */
+            FlapAlphabetConfig.encodeDelimited = function encodeDelimited(message, writer) {
+                return this.encode(message, writer).ldelim();
+            };
+    
+            /**
+             * Decodes a FlapAlphabetConfig message from the specified reader or buffer.
+             * @function decode
+             * @memberof PB.FlapAlphabetConfig
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @param {number} [length] Message length if known beforehand
+             * @returns {PB.FlapAlphabetConfig} FlapAlphabetConfig
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            FlapAlphabetConfig.decode = function decode(reader, length) {
+                if (!(reader instanceof $Reader))
+                    reader = $Reader.create(reader);
+                var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.FlapAlphabetConfig();
+                while (reader.pos < end) {
+                    var tag = reader.uint32();
+                    switch (tag >>> 3) {
+                    case 1:
+                        if (!(message.alphabets && message.alphabets.length))
+                            message.alphabets = [];
+                        message.alphabets.push($root.PB.FlapAlphabetConfig.Alphabet.decode(reader, reader.uint32()));
+                        break;
+                    case 2:
+                        if (!(message.moduleAlphabet && message.moduleAlphabet.length))
+                            message.moduleAlphabet = [];
+                        if ((tag & 7) === 2) {
+                            var end2 = reader.uint32() + reader.pos;
+                            while (reader.pos < end2)
+                                message.moduleAlphabet.push(reader.uint32());
+                        } else
+                            message.moduleAlphabet.push(reader.uint32());
+                        break;
+                    default:
+                        reader.skipType(tag & 7);
+                        break;
+                    }
+                }
+                return message;
+            };
+    
+            /**
+             * Decodes a FlapAlphabetConfig message from the specified reader or buffer, length delimited.
+             * @function decodeDelimited
+             * @memberof PB.FlapAlphabetConfig
+             * @static
+             * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+             * @returns {PB.FlapAlphabetConfig} FlapAlphabetConfig
+             * @throws {Error} If the payload is not a reader or valid buffer
+             * @throws {$protobuf.util.ProtocolError} If required fields are missing
+             */
+            FlapAlphabetConfig.decodeDelimited = function decodeDelimited(reader) {
+                if (!(reader instanceof $Reader))
+                    reader = new $Reader(reader);
+                return this.decode(reader, reader.uint32());
+            };
+    
+            /**
+             * Verifies a FlapAlphabetConfig message.
+             * @function verify
+             * @memberof PB.FlapAlphabetConfig
+             * @static
+             * @param {Object.<string,*>} message Plain object to verify
+             * @returns {string|null} `null` if valid, otherwise the reason why it is not
+             */
+            FlapAlphabetConfig.verify = function verify(message) {
+                if (typeof message !== "object" || message === null)
+                    return "object expected";
+                if (message.alphabets != null && message.hasOwnProperty("alphabets")) {
+                    if (!Array.isArray(message.alphabets))
+                        return "alphabets: array expected";
+                    for (var i = 0; i < message.alphabets.length; ++i) {
+                        var error = $root.PB.FlapAlphabetConfig.Alphabet.verify(message.alphabets[i]);
+                        if (error)
+                            return "alphabets." + error;
+                    }
+                }
+                if (message.moduleAlphabet != null && message.hasOwnProperty("moduleAlphabet")) {
+                    if (!Array.isArray(message.moduleAlphabet))
+                        return "moduleAlphabet: array expected";
+                    for (var i = 0; i < message.moduleAlphabet.length; ++i)
+                        if (!$util.isInteger(message.moduleAlphabet[i]))
+                            return "moduleAlphabet: integer[] expected";
+                }
+                return null;
+            };
+    
+            /**
+             * Creates a FlapAlphabetConfig message from a plain object. Also converts values to their respective internal types.
+             * @function fromObject
+             * @memberof PB.FlapAlphabetConfig
+             * @static
+             * @param {Object.<string,*>} object Plain object
+             * @returns {PB.FlapAlphabetConfig} FlapAlphabetConfig
+             */
+            FlapAlphabetConfig.fromObject = function fromObject(object) {
+                if (object instanceof $root.PB.FlapAlphabetConfig)
+                    return object;
+                var message = new $root.PB.FlapAlphabetConfig();
+                if (object.alphabets) {
+                    if (!Array.isArray(object.alphabets))
+                        throw TypeError(".PB.FlapAlphabetConfig.alphabets: array expected");
+                    message.alphabets = [];
+                    for (var i = 0; i < object.alphabets.length; ++i) {
+                        if (typeof object.alphabets[i] !== "object")
+                            throw TypeError(".PB.FlapAlphabetConfig.alphabets: object expected");
+                        message.alphabets[i] = $root.PB.FlapAlphabetConfig.Alphabet.fromObject(object.alphabets[i]);
+                    }
+                }
+                if (object.moduleAlphabet) {
+                    if (!Array.isArray(object.moduleAlphabet))
+                        throw TypeError(".PB.FlapAlphabetConfig.moduleAlphabet: array expected");
+                    message.moduleAlphabet = [];
+                    for (var i = 0; i < object.moduleAlphabet.length; ++i)
+                        message.moduleAlphabet[i] = object.moduleAlphabet[i] >>> 0;
+                }
+                return message;
+            };
+    
+            /**
+             * Creates a plain object from a FlapAlphabetConfig message. Also converts values to other types if specified.
+             * @function toObject
+             * @memberof PB.FlapAlphabetConfig
+             * @static
+             * @param {PB.FlapAlphabetConfig} message FlapAlphabetConfig
+             * @param {$protobuf.IConversionOptions} [options] Conversion options
+             * @returns {Object.<string,*>} Plain object
+             */
+            FlapAlphabetConfig.toObject = function toObject(message, options) {
+                if (!options)
+                    options = {};
+                var object = {};
+                if (options.arrays || options.defaults) {
+                    object.alphabets = [];
+                    object.moduleAlphabet = [];
+                }
+                if (message.alphabets && message.alphabets.length) {
+                    object.alphabets = [];
+                    for (var j = 0; j < message.alphabets.length; ++j)
+                        object.alphabets[j] = $root.PB.FlapAlphabetConfig.Alphabet.toObject(message.alphabets[j], options);
+                }
+                if (message.moduleAlphabet && message.moduleAlphabet.length) {
+                    object.moduleAlphabet = [];
+                    for (var j = 0; j < message.moduleAlphabet.length; ++j)
+                        object.moduleAlphabet[j] = message.moduleAlphabet[j];
+                }
+                return object;
+            };
+    
+            /**
+             * Converts this FlapAlphabetConfig to JSON.
+             * @function toJSON
+             * @memberof PB.FlapAlphabetConfig
+             * @instance
+             * @returns {Object.<string,*>} JSON object
+             */
+            FlapAlphabetConfig.prototype.toJSON = function toJSON() {
+                return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+            };
+    
+            FlapAlphabetConfig.Alphabet = (function() {
+    
+                /**
+                 * Properties of an Alphabet.
+                 * @memberof PB.FlapAlphabetConfig
+                 * @interface IAlphabet
+                 * @property {string|null} [flaps] The characters on the flaps, as UTF-8, in spool order starting from the home flap. Must have exactly one
+                 * character per flap.
+                 */
+    
+                /**
+                 * Constructs a new Alphabet.
+                 * @memberof PB.FlapAlphabetConfig
+                 * @classdesc Represents an Alphabet.
+                 * @implements IAlphabet
+                 * @constructor
+                 * @param {PB.FlapAlphabetConfig.IAlphabet=} [properties] Properties to set
+                 */
+                function Alphabet(properties) {
+                    if (properties)
+                        for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                            if (properties[keys[i]] != null)
+                                this[keys[i]] = properties[keys[i]];
+                }
+    
+                /**
+                 * The characters on the flaps, as UTF-8, in spool order starting from the home flap. Must have exactly one
+                 * character per flap.
+                 * @member {string} flaps
+                 * @memberof PB.FlapAlphabetConfig.Alphabet
+                 * @instance
+                 */
+                Alphabet.prototype.flaps = "";
+    
+                /**
+                 * Creates a new Alphabet instance using the specified properties.
+                 * @function create
+                 * @memberof PB.FlapAlphabetConfig.Alphabet
+                 * @static
+                 * @param {PB.FlapAlphabetConfig.IAlphabet=} [properties] Properties to set
+                 * @returns {PB.FlapAlphabetConfig.Alphabet} Alphabet instance
+                 */
+                Alphabet.create = function create(properties) {
+                    return new Alphabet(properties);
+                };
+    
+                /**
+                 * Encodes the specified Alphabet message. Does not implicitly {@link PB.FlapAlphabetConfig.Alphabet.verify|verify} messages.
+                 * @function encode
+                 * @memberof PB.FlapAlphabetConfig.Alphabet
+                 * @static
+                 * @param {PB.FlapAlphabetConfig.IAlphabet} message Alphabet message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                Alphabet.encode = function encode(message, writer) {
+                    if (!writer)
+                        writer = $Writer.create();
+                    if (message.flaps != null && Object.hasOwnProperty.call(message, "flaps"))
+                        writer.uint32(/* id 1, wireType 2 =*/10).string(message.flaps);
+                    return writer;
+                };
+    
+                /**
+                 * Encodes the specified Alphabet message, length delimited. Does not implicitly {@link PB.FlapAlphabetConfig.Alphabet.verify|verify} messages.
+                 * @function encodeDelimited
+                 * @memberof PB.FlapAlphabetConfig.Alphabet
+                 * @static
+                 * @param {PB.FlapAlphabetConfig.IAlphabet} message Alphabet message or plain object to encode
+                 * @param {$protobuf.Writer} [writer] Writer to encode to
+                 * @returns {$protobuf.Writer} Writer
+                 */
+                Alphabet.encodeDelimited = function encodeDelimited(message, writer) {
+                    return this.encode(message, writer).ldelim();
+                };
+    
+                /**
+                 * Decodes an Alphabet message from the specified reader or buffer.
+                 * @function decode
+                 * @memberof PB.FlapAlphabetConfig.Alphabet
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @param {number} [length] Message length if known beforehand
+                 * @returns {PB.FlapAlphabetConfig.Alphabet} Alphabet
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                Alphabet.decode = function decode(reader, length) {
+                    if (!(reader instanceof $Reader))
+                        reader = $Reader.create(reader);
+                    var end = length === undefined ? reader.len : reader.pos + length, message = new $root.PB.FlapAlphabetConfig.Alphabet();
+                    while (reader.pos < end) {
+                        var tag = reader.uint32();
+                        switch (tag >>> 3) {
+                        case 1:
+                            message.flaps = reader.string();
+                            break;
+                        default:
+                            reader.skipType(tag & 7);
+                            break;
+                        }
+                    }
+                    return message;
+                };
+    
+                /**
+                 * Decodes an Alphabet message from the specified reader or buffer, length delimited.
+                 * @function decodeDelimited
+                 * @memberof PB.FlapAlphabetConfig.Alphabet
+                 * @static
+                 * @param {$protobuf.Reader|Uint8Array} reader Reader or buffer to decode from
+                 * @returns {PB.FlapAlphabetConfig.Alphabet} Alphabet
+                 * @throws {Error} If the payload is not a reader or valid buffer
+                 * @throws {$protobuf.util.ProtocolError} If required fields are missing
+                 */
+                Alphabet.decodeDelimited = function decodeDelimited(reader) {
+                    if (!(reader instanceof $Reader))
+                        reader = new $Reader(reader);
+                    return this.decode(reader, reader.uint32());
+                };
+    
+                /**
+                 * Verifies an Alphabet message.
+                 * @function verify
+                 * @memberof PB.FlapAlphabetConfig.Alphabet
+                 * @static
+                 * @param {Object.<string,*>} message Plain object to verify
+                 * @returns {string|null} `null` if valid, otherwise the reason why it is not
+                 */
+                Alphabet.verify = function verify(message) {
+                    if (typeof message !== "object" || message === null)
+                        return "object expected";
+                    if (message.flaps != null && message.hasOwnProperty("flaps"))
+                        if (!$util.isString(message.flaps))
+                            return "flaps: string expected";
+                    return null;
+                };
+    
+                /**
+                 * Creates an Alphabet message from a plain object. Also converts values to their respective internal types.
+                 * @function fromObject
+                 * @memberof PB.FlapAlphabetConfig.Alphabet
+                 * @static
+                 * @param {Object.<string,*>} object Plain object
+                 * @returns {PB.FlapAlphabetConfig.Alphabet} Alphabet
+                 */
+                Alphabet.fromObject = function fromObject(object) {
+                    if (object instanceof $root.PB.FlapAlphabetConfig.Alphabet)
+                        return object;
+                    var message = new $root.PB.FlapAlphabetConfig.Alphabet();
+                    if (object.flaps != null)
+                        message.flaps = String(object.flaps);
+                    return message;
+                };
+    
+                /**
+                 * Creates a plain object from an Alphabet message. Also converts values to other types if specified.
+                 * @function toObject
+                 * @memberof PB.FlapAlphabetConfig.Alphabet
+                 * @static
+                 * @param {PB.FlapAlphabetConfig.Alphabet} message Alphabet
+                 * @param {$protobuf.IConversionOptions} [options] Conversion options
+                 * @returns {Object.<string,*>} Plain object
+                 */
+                Alphabet.toObject = function toObject(message, options) {
+                    if (!options)
+                        options = {};
+                    var object = {};
+                    if (options.defaults)
+                        object.flaps = "";
+                    if (message.flaps != null && message.hasOwnProperty("flaps"))
+                        object.flaps = message.flaps;
+                    return object;
+                };
+    
+                /**
+                 * Converts this Alphabet to JSON.
+                 * @function toJSON
+                 * @memberof PB.FlapAlphabetConfig.Alphabet
+                 * @instance
+                 * @returns {Object.<string,*>} JSON object
+                 */
+                Alphabet.prototype.toJSON = function toJSON() {
+                    return this.constructor.toObject(this, $protobuf.util.toJSONOptions);
+                };
+    
+                return Alphabet;
+            })();
+    
+            return FlapAlphabetConfig;
+        })();
+    
+        PB.ToSplitflap = (function() {
+    
+            /**
+             * Properties of a ToSplitflap.
+             * @memberof PB
+             * @interface IToSplitflap
+             * @property {number|null} [nonce] ToSplitflap nonce
+             * @property {PB.ISplitflapCommand|null} [splitflapCommand] ToSplitflap splitflapCommand
+             * @property {PB.ISplitflapConfig|null} [splitflapConfig] ToSplitflap splitflapConfig
+             * @property {PB.IRequestState|null} [requestState] ToSplitflap requestState
+             * @property {PB.IMotionConfig|null} [motionConfig] ToSplitflap motionConfig
+             * @property {PB.ISplitflapSequence|null} [splitflapSequence] ToSplitflap splitflapSequence
+             * @property {PB.IFlapAlphabetConfig|null} [flapAlphabetConfig] ToSplitflap flapAlphabetConfig
+             * @property {PB.IRequestMotionTrace|null} [requestMotionTrace] ToSplitflap requestMotionTrace
+             */
+    
+            /**
+             * Constructs a new ToSplitflap.
+             * @memberof PB
+             * @classdesc Represents a ToSplitflap.
+             * @implements IToSplitflap
+             * @constructor
+             * @param {PB.IToSplitflap=} [properties] Properties to set
+             */
+            function ToSplitflap(properties) {
+                if (properties)
+                    for (var keys = Object.keys(properties), i = 0; i < keys.length; ++i)
+                        if (properties[keys[i]] != null)
+                            this[keys[i]] = properties[keys[i]];
+            }
+    
+            /**
+             * ToSplitflap nonce.
+             * @member {number} nonce
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.nonce = 0;
+    
+            /**
+             * ToSplitflap splitflapCommand.
+             * @member {PB.ISplitflapCommand|null|undefined} splitflapCommand
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.splitflapCommand = null;
+    
+            /**
+             * ToSplitflap splitflapConfig.
+             * @member {PB.ISplitflapConfig|null|undefined} splitflapConfig
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.splitflapConfig = null;
+    
+            /**
+             * ToSplitflap requestState.
+             * @member {PB.IRequestState|null|undefined} requestState
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.requestState = null;
+    
+            /**
+             * ToSplitflap motionConfig.
+             * @member {PB.IMotionConfig|null|undefined} motionConfig
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.motionConfig = null;
+    
+            /**
+             * ToSplitflap splitflapSequence.
+             * @member {PB.ISplitflapSequence|null|undefined} splitflapSequence
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.splitflapSequence = null;
+    
+            /**
+             * ToSplitflap flapAlphabetConfig.
+             * @member {PB.IFlapAlphabetConfig|null|undefined} flapAlphabetConfig
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.flapAlphabetConfig = null;
+    
+            /**
+             * ToSplitflap requestMotionTrace.
+             * @member {PB.IRequestMotionTrace|null|undefined} requestMotionTrace
+             * @memberof PB.ToSplitflap
+             * @instance
+             */
+            ToSplitflap.prototype.requestMotionTrace = null;
     
             // OneOf field names bound to virtual getters and setters
             var $oneOfFields;
     
             /**
              * ToSplitflap payload.
-             * @member {"splitflapCommand"|"splitflapConfig"|undefined} payload
+             * @member {"splitflapCommand"|"splitflapConfig"|"requestState"|"motionConfig"|"splitflapSequence"|"flapAlphabetConfig"|"requestMotionTrace"|undefined} payload
              * @memberof PB.ToSplitflap
              * @instance
              */
             Object.defineProperty(ToSplitflap.prototype, "payload", {
-                get: $util.oneOfGetter($oneOfFields = ["splitflapCommand", "splitflapConfig"]),
+                get: $util.oneOfGetter($oneOfFields = ["splitflapCommand", "splitflapConfig", "requestState", "motionConfig", "splitflapSequence", "flapAlphabetConfig", "requestMotionTrace"]),
                 set: $util.oneOfSetter($oneOfFields)
             });
     
@@ -3130,6 +5700,16 @@
                     $root.PB.SplitflapCommand.encode(message.splitflapCommand, writer.uint32(/* id 2, wireType 2 =*/18).fork()).ldelim();
                 if (message.splitflapConfig != null && Object.hasOwnProperty.call(message, "splitflapConfig"))
                     $root.PB.SplitflapConfig.encode(message.splitflapConfig, writer.uint32(/* id 3, wireType 2 =*/26).fork()).ldelim();
+                if (message.requestState != null && Object.hasOwnProperty.call(message, "requestState"))
+                    $root.PB.RequestState.encode(message.requestState, writer.uint32(/* id 4, wireType 2 =*/34).fork()).ldelim();
+                if (message.motionConfig != null && Object.hasOwnProperty.call(message, "motionConfig"))
+                    $root.PB.MotionConfig.encode(message.motionConfig, writer.uint32(/* id 5, wireType 2 =*/42).fork()).ldelim();
+                if (message.splitflapSequence != null && Object.hasOwnProperty.call(message, "splitflapSequence"))
+                    $root.PB.SplitflapSequence.encode(message.splitflapSequence, writer.uint32(/* id 6, wireType 2 =*/50).fork()).ldelim();
+                if (message.flapAlphabetConfig != null && Object.hasOwnProperty.call(message, "flapAlphabetConfig"))
+                    $root.PB.FlapAlphabetConfig.encode(message.flapAlphabetConfig, writer.uint32(/* id 7, wireType 2 =*/58).fork()).ldelim();
+                if (message.requestMotionTrace != null && Object.hasOwnProperty.call(message, "requestMotionTrace"))
+                    $root.PB.RequestMotionTrace.encode(message.requestMotionTrace, writer.uint32(/* id 8, wireType 2 =*/66).fork()).ldelim();
                 return writer;
             };
     
@@ -3173,6 +5753,21 @@
                     case 3:
                         message.splitflapConfig = $root.PB.SplitflapConfig.decode(reader, reader.uint32());
                         break;
+                    case 4:
+                        message.requestState = $root.PB.RequestState.decode(reader, reader.uint32());
+                        break;
+                    case 5:
+                        message.motionConfig = $root.PB.MotionConfig.decode(reader, reader.uint32());
+                        break;
+                    case 6:
+                        message.splitflapSequence = $root.PB.SplitflapSequence.decode(reader, reader.uint32());
+                        break;
+                    case 7:
+                        message.flapAlphabetConfig = $root.PB.FlapAlphabetConfig.decode(reader, reader.uint32());
+                        break;
+                    case 8:
+                        message.requestMotionTrace = $root.PB.RequestMotionTrace.decode(reader, reader.uint32());
+                        break;
                     default:
                         reader.skipType(tag & 7);
                         break;
@@ -3230,6 +5825,56 @@
                             return "splitflapConfig." + error;
                     }
                 }
+                if (message.requestState != null && message.hasOwnProperty("requestState")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.RequestState.verify(message.requestState);
+                        if (error)
+                            return "requestState." + error;
+                    }
+                }
+                if (message.motionConfig != null && message.hasOwnProperty("motionConfig")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.MotionConfig.verify(message.motionConfig);
+                        if (error)
+                            return "motionConfig." + error;
+                    }
+                }
+                if (message.splitflapSequence != null && message.hasOwnProperty("splitflapSequence")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.SplitflapSequence.verify(message.splitflapSequence);
+                        if (error)
+                            return "splitflapSequence." + error;
+                    }
+                }
+                if (message.flapAlphabetConfig != null && message.hasOwnProperty("flapAlphabetConfig")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.FlapAlphabetConfig.verify(message.flapAlphabetConfig);
+                        if (error)
+                            return "flapAlphabetConfig." + error;
+                    }
+                }
+                if (message.requestMotionTrace != null && message.hasOwnProperty("requestMotionTrace")) {
+                    if (properties.payload === 1)
+                        return "payload: multiple values";
+                    properties.payload = 1;
+                    {
+                        var error = $root.PB.RequestMotionTrace.verify(message.requestMotionTrace);
+                        if (error)
+                            return "requestMotionTrace." + error;
+                    }
+                }
                 return null;
             };
     
@@ -3257,6 +5902,31 @@
                         throw TypeError(".PB.ToSplitflap.splitflapConfig: object expected");
                     message.splitflapConfig = $root.PB.SplitflapConfig.fromObject(object.splitflapConfig);
                 }
+                if (object.requestState != null) {
+                    if (typeof object.requestState !== "object")
+                        throw TypeError(".PB.ToSplitflap.requestState: object expected");
+                    message.requestState = $root.PB.RequestState.fromObject(object.requestState);
+                }
+                if (object.motionConfig != null) {
+                    if (typeof object.motionConfig !== "object")
+                        throw TypeError(".PB.ToSplitflap.motionConfig: object expected");
+                    message.motionConfig = $root.PB.MotionConfig.fromObject(object.motionConfig);
+                }
+                if (object.splitflapSequence != null) {
+                    if (typeof object.splitflapSequence !== "object")
+                        throw TypeError(".PB.ToSplitflap.splitflapSequence: object expected");
+                    message.splitflapSequence = $root.PB.SplitflapSequence.fromObject(object.splitflapSequence);
+                }
+                if (object.flapAlphabetConfig != null) {
+                    if (typeof object.flapAlphabetConfig !== "object")
+                        throw TypeError(".PB.ToSplitflap.flapAlphabetConfig: object expected");
+                    message.flapAlphabetConfig = $root.PB.FlapAlphabetConfig.fromObject(object.flapAlphabetConfig);
+                }
+                if (object.requestMotionTrace != null) {
+                    if (typeof object.requestMotionTrace !== "object")
+                        throw TypeError(".PB.ToSplitflap.requestMotionTrace: object expected");
+                    message.requestMotionTrace = $root.PB.RequestMotionTrace.fromObject(object.requestMotionTrace);
+                }
                 return message;
             };
     
@@ -3287,6 +5957,31 @@
                     if (options.oneofs)
                         object.payload = "splitflapConfig";
                 }
+                if (message.requestState != null && message.hasOwnProperty("requestState")) {
+                    object.requestState = $root.PB.RequestState.toObject(message.requestState, options);
+                    if (options.oneofs)
+                        object.payload = "requestState";
+                }
+                if (message.motionConfig != null && message.hasOwnProperty("motionConfig")) {
+                    object.motionConfig = $root.PB.MotionConfig.toObject(message.motionConfig, options);
+                    if (options.oneofs)
+                        object.payload = "motionConfig";
+                }
+                if (message.splitflapSequence != null && message.hasOwnProperty("splitflapSequence")) {
+                    object.splitflapSequence = $root.PB.SplitflapSequence.toObject(message.splitflapSequence, options);
+                    if (options.oneofs)
+                        object.payload = "splitflapSequence";
+                }
+                if (message.flapAlphabetConfig != null && message.hasOwnProperty("flapAlphabetConfig")) {
+                    object.flapAlphabetConfig = $root.PB.FlapAlphabetConfig.toObject(message.flapAlphabetConfig, options);
+                    if (options.oneofs)
+                        object.payload = "flapAlphabetConfig";
+                }
+                if (message.requestMotionTrace != null && message.hasOwnProperty("requestMotionTrace")) {
+                    object.requestMotionTrace = $root.PB.RequestMotionTrace.toObject(message.requestMotionTrace, options);
+                    if (options.oneofs)
+                        object.payload = "requestMotionTrace";
+                }
                 return object;
             };
     
@@ -0,0 +1,78 @@
+import argparse
+from collections import namedtuple
+import logging
+from queue import Queue
+
+from splitflap_proto import (
+    ask_for_serial_port,
+    splitflap_context,
+)
+
+# Layout of a MotionTraceEvent data word; keep in sync with arduino/splitflap/Splitflap/src/splitflap_module_data.h
+MOTION_TRACE_SENSOR = 0x8000
+MOTION_TRACE_STATUS = 0x4000
+MOTION_TRACE_PERIOD_SHIFT = 2
+
+STATES = ['NORMAL', 'LOOK_FOR_HOME', 'SENSOR_ERROR', 'PANIC', 'DISABLED']
+HOME_STATES = ['IGNORE', 'UNEXPECTED', 'EXPECTED']
+
+# A decoded trace event. For steps, period_micros is the step's period and state/home_state are None; for status
+# changes it's the other way around.
+Event = namedtuple('Event', ['step', 'sensor', 'period_micros', 'state', 'home_state'])
+
+
+def _name(names, value):
+    return names[value] if value < len(names) else str(value)
+
+
+def decode_event(word):
+    """Decodes one event of a MotionTrace message, packed as (step << 16) | data."""
+    step = word >> 16
+    data = word & 0xffff
+    sensor = bool(data & MOTION_TRACE_SENSOR)
+    if data & MOTION_TRACE_STATUS:
+        return Event(step, sensor, None, _name(STATES, data & 0x7), _name(HOME_STATES, (data >> 3) & 0x3))
+    return Event(step, sensor, (data & 0x3fff) << MOTION_TRACE_PERIOD_SHIFT, None, None)
+
+
+def decode_trace(motion_trace):
+    return [decode_event(word) for word in motion_trace.events]
+
+
+def format_trace(motion_trace):
+    """Formats a MotionTrace message as one line per event, marking where the home sensor changed."""
+    lines = [f'Module {motion_trace.module}: {len(motion_trace.events)} events'
+             + (' (stopped after an error)' if motion_trace.stopped else '')]
+    last_sensor = None
+    for event in decode_trace(motion_trace):
+        edge = ''
+        if last_sensor is not None and event.sensor != last_sensor:
+            edge = '  <- home sensor ' + ('on' if event.sensor else 'off')
+        last_sensor = event.sensor
+        sensor = 'H' if event.sensor else '.'
+        if event.state is not None:
+            lines.append(f'{event.step:5}  {sensor}  state {event.state}, home {event.home_state}{edge}')
+        else:
+            lines.append(f'{event.step:5}  {sensor}  step {event.period_micros:6}us{edge}')
+    return '\n'.join(lines)
+
+
+def _run(module):
+    p = ask_for_serial_port()
+    with splitflap_context(p) as s:
+        q = Queue()
+        s.add_handler('motion_trace', lambda message: q.put(message))
+        s.request_motion_trace(module)
+        print(format_trace(q.get()))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser('Dump and decode the recent step events of a splitflap module')
+    parser.add_argument('module', type=int, help='Index of the module to dump')
+    parser.add_argument('--verbose', '-v', action='store_true', help='Enable verbose logging')
+    args = parser.parse_args()
+
+    log_level = logging.DEBUG if args.verbose else logging.INFO
+    logging.basicConfig(level=log_level, format='%(asctime)s:%(name)s:%(levelname)s:%(message)s')
+
+    _run(args.module)
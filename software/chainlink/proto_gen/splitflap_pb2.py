@@ -1,11 +1,10 @@
+# -*- coding: utf-8 -*-
 # Generated by the protocol buffer compiler.  DO NOT EDIT!
 # source: splitflap.proto
-
-import sys
-_b=sys.version_info[0]<3 and (lambda x:x) or (lambda x:x.encode('latin1'))
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
 from google.protobuf import descriptor as _descriptor
-from google.protobuf import message as _message
-from google.protobuf import reflection as _reflection
+from google.protobuf import descriptor_pool as _descriptor_pool
 from google.protobuf import symbol_database as _symbol_database
 # @@protoc_insertion_point(imports)
 
@@ -15,908 +14,131 @@ _sym_db = _symbol_database.Default()
 import nanopb_pb2 as nanopb__pb2
 
 
-DESCRIPTOR = _descriptor.FileDescriptor(
-  name='splitflap.proto',
-  package='PB',
-  syntax='proto3',
-  serialized_options=None,
-  serialized_pb=_b('\n\x0fsplitflap.proto\x12\x02PB\x1a\x0cnanopb.proto\"\xee\x02\n\x0eSplitflapState\x12\x37\n\x07modules\x18\x01 \x03(\x0b\x32\x1e.PB.SplitflapState.ModuleStateB\x06\x92?\x03\x10\xff\x01\x1a\xa2\x02\n\x0bModuleState\x12\x33\n\x05state\x18\x01 \x01(\x0e\x32$.PB.SplitflapState.ModuleState.State\x12\x19\n\nflap_index\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x0e\n\x06moving\x18\x03 \x01(\x08\x12\x12\n\nhome_state\x18\x04 \x01(\x08\x12$\n\x15\x63ount_unexpected_home\x18\x05 \x01(\rB\x05\x92?\x02\x38\x08\x12 \n\x11\x63ount_missed_home\x18\x06 \x01(\rB\x05\x92?\x02\x38\x08\"W\n\x05State\x12\n\n\x06NORMAL\x10\x00\x12\x11\n\rLOOK_FOR_HOME\x10\x01\x12\x10\n\x0cSENSOR_ERROR\x10\x02\x12\t\n\x05PANIC\x10\x03\x12\x12\n\x0eSTATE_DISABLED\x10\x04\"\x1a\n\x03Log\x12\x13\n\x03msg\x18\x01 \x01(\tB\x06\x92?\x03p\xff\x01\"\x14\n\x03\x41\x63k\x12\r\n\x05nonce\x18\x01 \x01(\r\"\xa4\x05\n\x0fSupervisorState\x12\x15\n\ruptime_millis\x18\x01 \x01(\r\x12(\n\x05state\x18\x02 \x01(\x0e\x32\x19.PB.SupervisorState.State\x12\x44\n\x0epower_channels\x18\x03 \x03(\x0b\x32%.PB.SupervisorState.PowerChannelStateB\x05\x92?\x02\x10\x05\x12\x31\n\nfault_info\x18\x04 \x01(\x0b\x32\x1d.PB.SupervisorState.FaultInfo\x1aL\n\x11PowerChannelState\x12\x15\n\rvoltage_volts\x18\x01 \x01(\x02\x12\x14\n\x0c\x63urrent_amps\x18\x02 \x01(\x02\x12\n\n\x02on\x18\x03 \x01(\x08\x1a\x81\x02\n\tFaultInfo\x12\x35\n\x04type\x18\x01 \x01(\x0e\x32\'.PB.SupervisorState.FaultInfo.FaultType\x12\x13\n\x03msg\x18\x02 \x01(\tB\x06\x92?\x03p\xff\x01\x12\x11\n\tts_millis\x18\x03 \x01(\r\"\x94\x01\n\tFaultType\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x08\n\x04NONE\x10\x01\x12\x1e\n\x1aINRUSH_CURRENT_NOT_SETTLED\x10\x02\x12\x16\n\x12SPLITFLAP_SHUTDOWN\x10\x03\x12\x10\n\x0cOUT_OF_RANGE\x10\x04\x12\x10\n\x0cOVER_CURRENT\x10\x05\x12\x14\n\x10UNEXPECTED_POWER\x10\x06\"\x84\x01\n\x05State\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x1b\n\x17STARTING_VERIFY_PSU_OFF\x10\x01\x12\x1c\n\x18STARTING_VERIFY_VOLTAGES\x10\x02\x12\x1c\n\x18STARTING_ENABLE_CHANNELS\x10\x03\x12\n\n\x06NORMAL\x10\x04\x12\t\n\x05\x46\x41ULT\x10\x05\"\xaa\x01\n\rFromSplitflap\x12-\n\x0fsplitflap_state\x18\x01 \x01(\x0b\x32\x12.PB.SplitflapStateH\x00\x12\x16\n\x03log\x18\x02 \x01(\x0b\x32\x07.PB.LogH\x00\x12\x16\n\x03\x61\x63k\x18\x03 \x01(\x0b\x32\x07.PB.AckH\x00\x12/\n\x10supervisor_state\x18\x04 \x01(\x0b\x32\x13.PB.SupervisorStateH\x00\x42\t\n\x07payload\"\xeb\x01\n\x10SplitflapCommand\x12;\n\x07modules\x18\x02 \x03(\x0b\x32\".PB.SplitflapCommand.ModuleCommandB\x06\x92?\x03\x10\xff\x01\x1a\x99\x01\n\rModuleCommand\x12\x39\n\x06\x61\x63tion\x18\x01 \x01(\x0e\x32).PB.SplitflapCommand.ModuleCommand.Action\x12\x14\n\x05param\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\"7\n\x06\x41\x63tion\x12\t\n\x05NO_OP\x10\x00\x12\x0e\n\nGO_TO_FLAP\x10\x01\x12\x12\n\x0eRESET_AND_HOME\x10\x02\"\xb9\x01\n\x0fSplitflapConfig\x12\x39\n\x07modules\x18\x01 \x03(\x0b\x32 .PB.SplitflapConfig.ModuleConfigB\x06\x92?\x03\x10\xff\x01\x1ak\n\x0cModuleConfig\x12 \n\x11target_flap_index\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1d\n\x0emovement_nonce\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1a\n\x0breset_nonce\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08\"\x0e\n\x0cRequestState\"\xb6\x01\n\x0bToSplitflap\x12\r\n\x05nonce\x18\x01 \x01(\r\x12\x31\n\x11splitflap_command\x18\x02 \x01(\x0b\x32\x14.PB.SplitflapCommandH\x00\x12/\n\x10splitflap_config\x18\x03 \x01(\x0b\x32\x13.PB.SplitflapConfigH\x00\x12)\n\rrequest_state\x18\x04 \x01(\x0b\x32\x10.PB.RequestStateH\x00\x42\t\n\x07payloadb\x06proto3')
-  ,
-  dependencies=[nanopb__pb2.DESCRIPTOR,])
-
-
-
-_SPLITFLAPSTATE_MODULESTATE_STATE = _descriptor.EnumDescriptor(
-  name='State',
-  full_name='PB.SplitflapState.ModuleState.State',
-  filename=None,
-  file=DESCRIPTOR,
-  values=[
-    _descriptor.EnumValueDescriptor(
-      name='NORMAL', index=0, number=0,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='LOOK_FOR_HOME', index=1, number=1,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='SENSOR_ERROR', index=2, number=2,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='PANIC', index=3, number=3,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='STATE_DISABLED', index=4, number=4,
-      serialized_options=None,
-      type=None),
-  ],
-  containing_type=None,
-  serialized_options=None,
-  serialized_start=317,
-  serialized_end=404,
-)
-_sym_db.RegisterEnumDescriptor(_SPLITFLAPSTATE_MODULESTATE_STATE)
-
-_SUPERVISORSTATE_FAULTINFO_FAULTTYPE = _descriptor.EnumDescriptor(
-  name='FaultType',
-  full_name='PB.SupervisorState.FaultInfo.FaultType',
-  filename=None,
-  file=DESCRIPTOR,
-  values=[
-    _descriptor.EnumValueDescriptor(
-      name='UNKNOWN', index=0, number=0,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='NONE', index=1, number=1,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='INRUSH_CURRENT_NOT_SETTLED', index=2, number=2,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='SPLITFLAP_SHUTDOWN', index=3, number=3,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='OUT_OF_RANGE', index=4, number=4,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='OVER_CURRENT', index=5, number=5,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='UNEXPECTED_POWER', index=6, number=6,
-      serialized_options=None,
-      type=None),
-  ],
-  containing_type=None,
-  serialized_options=None,
-  serialized_start=850,
-  serialized_end=998,
-)
-_sym_db.RegisterEnumDescriptor(_SUPERVISORSTATE_FAULTINFO_FAULTTYPE)
-
-_SUPERVISORSTATE_STATE = _descriptor.EnumDescriptor(
-  name='State',
-  full_name='PB.SupervisorState.State',
-  filename=None,
-  file=DESCRIPTOR,
-  values=[
-    _descriptor.EnumValueDescriptor(
-      name='UNKNOWN', index=0, number=0,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='STARTING_VERIFY_PSU_OFF', index=1, number=1,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='STARTING_VERIFY_VOLTAGES', index=2, number=2,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='STARTING_ENABLE_CHANNELS', index=3, number=3,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='NORMAL', index=4, number=4,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='FAULT', index=5, number=5,
-      serialized_options=None,
-      type=None),
-  ],
-  containing_type=None,
-  serialized_options=None,
-  serialized_start=1001,
-  serialized_end=1133,
-)
-_sym_db.RegisterEnumDescriptor(_SUPERVISORSTATE_STATE)
-
-_SPLITFLAPCOMMAND_MODULECOMMAND_ACTION = _descriptor.EnumDescriptor(
-  name='Action',
-  full_name='PB.SplitflapCommand.ModuleCommand.Action',
-  filename=None,
-  file=DESCRIPTOR,
-  values=[
-    _descriptor.EnumValueDescriptor(
-      name='NO_OP', index=0, number=0,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='GO_TO_FLAP', index=1, number=1,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='RESET_AND_HOME', index=2, number=2,
-      serialized_options=None,
-      type=None),
-  ],
-  containing_type=None,
-  serialized_options=None,
-  serialized_start=1489,
-  serialized_end=1544,
-)
-_sym_db.RegisterEnumDescriptor(_SPLITFLAPCOMMAND_MODULECOMMAND_ACTION)
-
-
-_SPLITFLAPSTATE_MODULESTATE = _descriptor.Descriptor(
-  name='ModuleState',
-  full_name='PB.SplitflapState.ModuleState',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='state', full_name='PB.SplitflapState.ModuleState.state', index=0,
-      number=1, type=14, cpp_type=8, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='flap_index', full_name='PB.SplitflapState.ModuleState.flap_index', index=1,
-      number=2, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='moving', full_name='PB.SplitflapState.ModuleState.moving', index=2,
-      number=3, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='home_state', full_name='PB.SplitflapState.ModuleState.home_state', index=3,
-      number=4, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='count_unexpected_home', full_name='PB.SplitflapState.ModuleState.count_unexpected_home', index=4,
-      number=5, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='count_missed_home', full_name='PB.SplitflapState.ModuleState.count_missed_home', index=5,
-      number=6, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-    _SPLITFLAPSTATE_MODULESTATE_STATE,
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=114,
-  serialized_end=404,
-)
-
-_SPLITFLAPSTATE = _descriptor.Descriptor(
-  name='SplitflapState',
-  full_name='PB.SplitflapState',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='modules', full_name='PB.SplitflapState.modules', index=0,
-      number=1, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\003\020\377\001'), file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[_SPLITFLAPSTATE_MODULESTATE, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=38,
-  serialized_end=404,
-)
-
-
-_LOG = _descriptor.Descriptor(
-  name='Log',
-  full_name='PB.Log',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='msg', full_name='PB.Log.msg', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\003p\377\001'), file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=406,
-  serialized_end=432,
-)
-
-
-_ACK = _descriptor.Descriptor(
-  name='Ack',
-  full_name='PB.Ack',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='nonce', full_name='PB.Ack.nonce', index=0,
-      number=1, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=434,
-  serialized_end=454,
-)
-
-
-_SUPERVISORSTATE_POWERCHANNELSTATE = _descriptor.Descriptor(
-  name='PowerChannelState',
-  full_name='PB.SupervisorState.PowerChannelState',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='voltage_volts', full_name='PB.SupervisorState.PowerChannelState.voltage_volts', index=0,
-      number=1, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='current_amps', full_name='PB.SupervisorState.PowerChannelState.current_amps', index=1,
-      number=2, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='on', full_name='PB.SupervisorState.PowerChannelState.on', index=2,
-      number=3, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=662,
-  serialized_end=738,
-)
-
-_SUPERVISORSTATE_FAULTINFO = _descriptor.Descriptor(
-  name='FaultInfo',
-  full_name='PB.SupervisorState.FaultInfo',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='type', full_name='PB.SupervisorState.FaultInfo.type', index=0,
-      number=1, type=14, cpp_type=8, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='msg', full_name='PB.SupervisorState.FaultInfo.msg', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\003p\377\001'), file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='ts_millis', full_name='PB.SupervisorState.FaultInfo.ts_millis', index=2,
-      number=3, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-    _SUPERVISORSTATE_FAULTINFO_FAULTTYPE,
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=741,
-  serialized_end=998,
-)
-
-_SUPERVISORSTATE = _descriptor.Descriptor(
-  name='SupervisorState',
-  full_name='PB.SupervisorState',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='uptime_millis', full_name='PB.SupervisorState.uptime_millis', index=0,
-      number=1, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='state', full_name='PB.SupervisorState.state', index=1,
-      number=2, type=14, cpp_type=8, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='power_channels', full_name='PB.SupervisorState.power_channels', index=2,
-      number=3, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\002\020\005'), file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='fault_info', full_name='PB.SupervisorState.fault_info', index=3,
-      number=4, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[_SUPERVISORSTATE_POWERCHANNELSTATE, _SUPERVISORSTATE_FAULTINFO, ],
-  enum_types=[
-    _SUPERVISORSTATE_STATE,
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=457,
-  serialized_end=1133,
-)
-
-
-_FROMSPLITFLAP = _descriptor.Descriptor(
-  name='FromSplitflap',
-  full_name='PB.FromSplitflap',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='splitflap_state', full_name='PB.FromSplitflap.splitflap_state', index=0,
-      number=1, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='log', full_name='PB.FromSplitflap.log', index=1,
-      number=2, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='ack', full_name='PB.FromSplitflap.ack', index=2,
-      number=3, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='supervisor_state', full_name='PB.FromSplitflap.supervisor_state', index=3,
-      number=4, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-    _descriptor.OneofDescriptor(
-      name='payload', full_name='PB.FromSplitflap.payload',
-      index=0, containing_type=None, fields=[]),
-  ],
-  serialized_start=1136,
-  serialized_end=1306,
-)
-
-
-_SPLITFLAPCOMMAND_MODULECOMMAND = _descriptor.Descriptor(
-  name='ModuleCommand',
-  full_name='PB.SplitflapCommand.ModuleCommand',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='action', full_name='PB.SplitflapCommand.ModuleCommand.action', index=0,
-      number=1, type=14, cpp_type=8, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='param', full_name='PB.SplitflapCommand.ModuleCommand.param', index=1,
-      number=2, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-    _SPLITFLAPCOMMAND_MODULECOMMAND_ACTION,
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1391,
-  serialized_end=1544,
-)
-
-_SPLITFLAPCOMMAND = _descriptor.Descriptor(
-  name='SplitflapCommand',
-  full_name='PB.SplitflapCommand',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='modules', full_name='PB.SplitflapCommand.modules', index=0,
-      number=2, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\003\020\377\001'), file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[_SPLITFLAPCOMMAND_MODULECOMMAND, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1309,
-  serialized_end=1544,
-)
-
-
-_SPLITFLAPCONFIG_MODULECONFIG = _descriptor.Descriptor(
-  name='ModuleConfig',
-  full_name='PB.SplitflapConfig.ModuleConfig',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='target_flap_index', full_name='PB.SplitflapConfig.ModuleConfig.target_flap_index', index=0,
-      number=1, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='movement_nonce', full_name='PB.SplitflapConfig.ModuleConfig.movement_nonce', index=1,
-      number=2, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='reset_nonce', full_name='PB.SplitflapConfig.ModuleConfig.reset_nonce', index=2,
-      number=3, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\0028\010'), file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1625,
-  serialized_end=1732,
-)
-
-_SPLITFLAPCONFIG = _descriptor.Descriptor(
-  name='SplitflapConfig',
-  full_name='PB.SplitflapConfig',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='modules', full_name='PB.SplitflapConfig.modules', index=0,
-      number=1, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=_b('\222?\003\020\377\001'), file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[_SPLITFLAPCONFIG_MODULECONFIG, ],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1547,
-  serialized_end=1732,
-)
-
-
-_REQUESTSTATE = _descriptor.Descriptor(
-  name='RequestState',
-  full_name='PB.RequestState',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1734,
-  serialized_end=1748,
-)
-
-
-_TOSPLITFLAP = _descriptor.Descriptor(
-  name='ToSplitflap',
-  full_name='PB.ToSplitflap',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='nonce', full_name='PB.ToSplitflap.nonce', index=0,
-      number=1, type=13, cpp_type=3, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='splitflap_command', full_name='PB.ToSplitflap.splitflap_command', index=1,
-      number=2, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='splitflap_config', full_name='PB.ToSplitflap.splitflap_config', index=2,
-      number=3, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='request_state', full_name='PB.ToSplitflap.request_state', index=3,
-      number=4, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-    _descriptor.OneofDescriptor(
-      name='payload', full_name='PB.ToSplitflap.payload',
-      index=0, containing_type=None, fields=[]),
-  ],
-  serialized_start=1751,
-  serialized_end=1933,
-)
-
-_SPLITFLAPSTATE_MODULESTATE.fields_by_name['state'].enum_type = _SPLITFLAPSTATE_MODULESTATE_STATE
-_SPLITFLAPSTATE_MODULESTATE.containing_type = _SPLITFLAPSTATE
-_SPLITFLAPSTATE_MODULESTATE_STATE.containing_type = _SPLITFLAPSTATE_MODULESTATE
-_SPLITFLAPSTATE.fields_by_name['modules'].message_type = _SPLITFLAPSTATE_MODULESTATE
-_SUPERVISORSTATE_POWERCHANNELSTATE.containing_type = _SUPERVISORSTATE
-_SUPERVISORSTATE_FAULTINFO.fields_by_name['type'].enum_type = _SUPERVISORSTATE_FAULTINFO_FAULTTYPE
-_SUPERVISORSTATE_FAULTINFO.containing_type = _SUPERVISORSTATE
-_SUPERVISORSTATE_FAULTINFO_FAULTTYPE.containing_type = _SUPERVISORSTATE_FAULTINFO
-_SUPERVISORSTATE.fields_by_name['state'].enum_type = _SUPERVISORSTATE_STATE
-_SUPERVISORSTATE.fields_by_name['power_channels'].message_type = _SUPERVISORSTATE_POWERCHANNELSTATE
-_SUPERVISORSTATE.fields_by_name['fault_info'].message_type = _SUPERVISORSTATE_FAULTINFO
-_SUPERVISORSTATE_STATE.containing_type = _SUPERVISORSTATE
-_FROMSPLITFLAP.fields_by_name['splitflap_state'].message_type = _SPLITFLAPSTATE
-_FROMSPLITFLAP.fields_by_name['log'].message_type = _LOG
-_FROMSPLITFLAP.fields_by_name['ack'].message_type = _ACK
-_FROMSPLITFLAP.fields_by_name['supervisor_state'].message_type = _SUPERVISORSTATE
-_FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
-  _FROMSPLITFLAP.fields_by_name['splitflap_state'])
-_FROMSPLITFLAP.fields_by_name['splitflap_state'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
-_FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
-  _FROMSPLITFLAP.fields_by_name['log'])
-_FROMSPLITFLAP.fields_by_name['log'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
-_FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
-  _FROMSPLITFLAP.fields_by_name['ack'])
-_FROMSPLITFLAP.fields_by_name['ack'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
-_FROMSPLITFLAP.oneofs_by_name['payload'].fields.append(
-  _FROMSPLITFLAP.fields_by_name['supervisor_state'])
-_FROMSPLITFLAP.fields_by_name['supervisor_state'].containing_oneof = _FROMSPLITFLAP.oneofs_by_name['payload']
-_SPLITFLAPCOMMAND_MODULECOMMAND.fields_by_name['action'].enum_type = _SPLITFLAPCOMMAND_MODULECOMMAND_ACTION
-_SPLITFLAPCOMMAND_MODULECOMMAND.containing_type = _SPLITFLAPCOMMAND
-_SPLITFLAPCOMMAND_MODULECOMMAND_ACTION.containing_type = _SPLITFLAPCOMMAND_MODULECOMMAND
-_SPLITFLAPCOMMAND.fields_by_name['modules'].message_type = _SPLITFLAPCOMMAND_MODULECOMMAND
-_SPLITFLAPCONFIG_MODULECONFIG.containing_type = _SPLITFLAPCONFIG
-_SPLITFLAPCONFIG.fields_by_name['modules'].message_type = _SPLITFLAPCONFIG_MODULECONFIG
-_TOSPLITFLAP.fields_by_name['splitflap_command'].message_type = _SPLITFLAPCOMMAND
-_TOSPLITFLAP.fields_by_name['splitflap_config'].message_type = _SPLITFLAPCONFIG
-_TOSPLITFLAP.fields_by_name['request_state'].message_type = _REQUESTSTATE
-_TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
-  _TOSPLITFLAP.fields_by_name['splitflap_command'])
-_TOSPLITFLAP.fields_by_name['splitflap_command'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
-_TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
-  _TOSPLITFLAP.fields_by_name['splitflap_config'])
-_TOSPLITFLAP.fields_by_name['splitflap_config'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
-_TOSPLITFLAP.oneofs_by_name['payload'].fields.append(
-  _TOSPLITFLAP.fields_by_name['request_state'])
-_TOSPLITFLAP.fields_by_name['request_state'].containing_oneof = _TOSPLITFLAP.oneofs_by_name['payload']
-DESCRIPTOR.message_types_by_name['SplitflapState'] = _SPLITFLAPSTATE
-DESCRIPTOR.message_types_by_name['Log'] = _LOG
-DESCRIPTOR.message_types_by_name['Ack'] = _ACK
-DESCRIPTOR.message_types_by_name['SupervisorState'] = _SUPERVISORSTATE
-DESCRIPTOR.message_types_by_name['FromSplitflap'] = _FROMSPLITFLAP
-DESCRIPTOR.message_types_by_name['SplitflapCommand'] = _SPLITFLAPCOMMAND
-DESCRIPTOR.message_types_by_name['SplitflapConfig'] = _SPLITFLAPCONFIG
-DESCRIPTOR.message_types_by_name['RequestState'] = _REQUESTSTATE
-DESCRIPTOR.message_types_by_name['ToSplitflap'] = _TOSPLITFLAP
-_sym_db.RegisterFileDescriptor(DESCRIPTOR)
-
-SplitflapState = _reflection.GeneratedProtocolMessageType('SplitflapState', (_message.Message,), dict(
-
-  ModuleState = _reflection.GeneratedProtocolMessageType('ModuleState', (_message.Message,), dict(
-    DESCRIPTOR = _SPLITFLAPSTATE_MODULESTATE,
-    __module__ = 'splitflap_pb2'
-    # @@protoc_insertion_point(class_scope:PB.SplitflapState.ModuleState)
-    ))
-  ,
-  DESCRIPTOR = _SPLITFLAPSTATE,
-  __module__ = 'splitflap_pb2'
-  # @@protoc_insertion_point(class_scope:PB.SplitflapState)
-  ))
-_sym_db.RegisterMessage(SplitflapState)
-_sym_db.RegisterMessage(SplitflapState.ModuleState)
-
-Log = _reflection.GeneratedProtocolMessageType('Log', (_message.Message,), dict(
-  DESCRIPTOR = _LOG,
-  __module__ = 'splitflap_pb2'
-  # @@protoc_insertion_point(class_scope:PB.Log)
-  ))
-_sym_db.RegisterMessage(Log)
-
-Ack = _reflection.GeneratedProtocolMessageType('Ack', (_message.Message,), dict(
-  DESCRIPTOR = _ACK,
-  __module__ = 'splitflap_pb2'
-  # @@protoc_insertion_point(class_scope:PB.Ack)
-  ))
-_sym_db.RegisterMessage(Ack)
-
-SupervisorState = _reflection.GeneratedProtocolMessageType('SupervisorState', (_message.Message,), dict(
-
-  PowerChannelState = _reflection.GeneratedProtocolMessageType('PowerChannelState', (_message.Message,), dict(
-    DESCRIPTOR = _SUPERVISORSTATE_POWERCHANNELSTATE,
-    __module__ = 'splitflap_pb2'
-    # @@protoc_insertion_point(class_scope:PB.SupervisorState.PowerChannelState)
-    ))
-  ,
-
-  FaultInfo = _reflection.GeneratedProtocolMessageType('FaultInfo', (_message.Message,), dict(
-    DESCRIPTOR = _SUPERVISORSTATE_FAULTINFO,
-    __module__ = 'splitflap_pb2'
-    # @@protoc_insertion_point(class_scope:PB.SupervisorState.FaultInfo)
-    ))
-  ,
-  DESCRIPTOR = _SUPERVISORSTATE,
-  __module__ = 'splitflap_pb2'
-  # @@protoc_insertion_point(class_scope:PB.SupervisorState)
-  ))
-_sym_db.RegisterMessage(SupervisorState)
-_sym_db.RegisterMessage(SupervisorState.PowerChannelState)
-_sym_db.RegisterMessage(SupervisorState.FaultInfo)
-
-FromSplitflap = _reflection.GeneratedProtocolMessageType('FromSplitflap', (_message.Message,), dict(
-  DESCRIPTOR = _FROMSPLITFLAP,
-  __module__ = 'splitflap_pb2'
-  # @@protoc_insertion_point(class_scope:PB.FromSplitflap)
-  ))
-_sym_db.RegisterMessage(FromSplitflap)
-
-SplitflapCommand = _reflection.GeneratedProtocolMessageType('SplitflapCommand', (_message.Message,), dict(
-
-  ModuleCommand = _reflection.GeneratedProtocolMessageType('ModuleCommand', (_message.Message,), dict(
-    DESCRIPTOR = _SPLITFLAPCOMMAND_MODULECOMMAND,
-    __module__ = 'splitflap_pb2'
-    # @@protoc_insertion_point(class_scope:PB.SplitflapCommand.ModuleCommand)
-    ))
-  ,
-  DESCRIPTOR = _SPLITFLAPCOMMAND,
-  __module__ = 'splitflap_pb2'
-  # @@protoc_insertion_point(class_scope:PB.SplitflapCommand)
-  ))
-_sym_db.RegisterMessage(SplitflapCommand)
-_sym_db.RegisterMessage(SplitflapCommand.ModuleCommand)
-
-SplitflapConfig = _reflection.GeneratedProtocolMessageType('SplitflapConfig', (_message.Message,), dict(
-
-  ModuleConfig = _reflection.GeneratedProtocolMessageType('ModuleConfig', (_message.Message,), dict(
-    DESCRIPTOR = _SPLITFLAPCONFIG_MODULECONFIG,
-    __module__ = 'splitflap_pb2'
-    # @@protoc_insertion_point(class_scope:PB.SplitflapConfig.ModuleConfig)
-    ))
-  ,
-  DESCRIPTOR = _SPLITFLAPCONFIG,
-  __module__ = 'splitflap_pb2'
-  # @@protoc_insertion_point(class_scope:PB.SplitflapConfig)
-  ))
-_sym_db.RegisterMessage(SplitflapConfig)
-_sym_db.RegisterMessage(SplitflapConfig.ModuleConfig)
-
-RequestState = _reflection.GeneratedProtocolMessageType('RequestState', (_message.Message,), dict(
-  DESCRIPTOR = _REQUESTSTATE,
-  __module__ = 'splitflap_pb2'
-  # @@protoc_insertion_point(class_scope:PB.RequestState)
-  ))
-_sym_db.RegisterMessage(RequestState)
-
-ToSplitflap = _reflection.GeneratedProtocolMessageType('ToSplitflap', (_message.Message,), dict(
-  DESCRIPTOR = _TOSPLITFLAP,
-  __module__ = 'splitflap_pb2'
-  # @@protoc_insertion_point(class_scope:PB.ToSplitflap)
-  ))
-_sym_db.RegisterMessage(ToSplitflap)
-
-
-_SPLITFLAPSTATE_MODULESTATE.fields_by_name['flap_index']._options = None
-_SPLITFLAPSTATE_MODULESTATE.fields_by_name['count_unexpected_home']._options = None
-_SPLITFLAPSTATE_MODULESTATE.fields_by_name['count_missed_home']._options = None
-_SPLITFLAPSTATE.fields_by_name['modules']._options = None
-_LOG.fields_by_name['msg']._options = None
-_SUPERVISORSTATE_FAULTINFO.fields_by_name['msg']._options = None
-_SUPERVISORSTATE.fields_by_name['power_channels']._options = None
-_SPLITFLAPCOMMAND_MODULECOMMAND.fields_by_name['param']._options = None
-_SPLITFLAPCOMMAND.fields_by_name['modules']._options = None
-_SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['target_flap_index']._options = None
-_SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['movement_nonce']._options = None
-_SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['reset_nonce']._options = None
-_SPLITFLAPCONFIG.fields_by_name['modules']._options = None
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0fsplitflap.proto\x12\x02PB\x1a\x0cnanopb.proto\"\x9c\x04\n\x0eSplitflapState\x12\x37\n\x07modules\x18\x01 \x03(\x0b\x32\x1e.PB.SplitflapState.ModuleStateB\x06\x92?\x03\x10\xff\x01\x1a\xd0\x03\n\x0bModuleState\x12\x33\n\x05state\x18\x01 \x01(\x0e\x32$.PB.SplitflapState.ModuleState.State\x12\x19\n\nflap_index\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x0e\n\x06moving\x18\x03 \x01(\x08\x12\x12\n\nhome_state\x18\x04 \x01(\x08\x12$\n\x15\x63ount_unexpected_home\x18\x05 \x01(\rB\x05\x92?\x02\x38\x08\x12 \n\x11\x63ount_missed_home\x18\x06 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1d\n\x0emax_accel_step\x18\x07 \x01(\rB\x05\x92?\x02\x38\x10\x12\x19\n\neta_millis\x18\x08 \x01(\rB\x05\x92?\x02\x38\x10\x12\x33\n\x05\x63oils\x18\t \x01(\x0e\x32$.PB.SplitflapState.ModuleState.Coils\"W\n\x05State\x12\n\n\x06NORMAL\x10\x00\x12\x11\n\rLOOK_FOR_HOME\x10\x01\x12\x10\n\x0cSENSOR_ERROR\x10\x02\x12\t\n\x05PANIC\x10\x03\x12\x12\n\x0eSTATE_DISABLED\x10\x04\"=\n\x05\x43oils\x12\x07\n\x03OFF\x10\x00\x12\x0c\n\x08STEPPING\x10\x01\x12\x0c\n\x08SETTLING\x10\x02\x12\x0f\n\x0bPULSED_HOLD\x10\x03\"\x1a\n\x03Log\x12\x13\n\x03msg\x18\x01 \x01(\tB\x06\x92?\x03p\xff\x01\"\x14\n\x03\x41\x63k\x12\r\n\x05nonce\x18\x01 \x01(\r\"\xa4\x05\n\x0fSupervisorState\x12\x15\n\ruptime_millis\x18\x01 \x01(\r\x12(\n\x05state\x18\x02 \x01(\x0e\x32\x19.PB.SupervisorState.State\x12\x44\n\x0epower_channels\x18\x03 \x03(\x0b\x32%.PB.SupervisorState.PowerChannelStateB\x05\x92?\x02\x10\x05\x12\x31\n\nfault_info\x18\x04 \x01(\x0b\x32\x1d.PB.SupervisorState.FaultInfo\x1aL\n\x11PowerChannelState\x12\x15\n\rvoltage_volts\x18\x01 \x01(\x02\x12\x14\n\x0c\x63urrent_amps\x18\x02 \x01(\x02\x12\n\n\x02on\x18\x03 \x01(\x08\x1a\x81\x02\n\tFaultInfo\x12\x35\n\x04type\x18\x01 \x01(\x0e\x32\'.PB.SupervisorState.FaultInfo.FaultType\x12\x13\n\x03msg\x18\x02 \x01(\tB\x06\x92?\x03p\xff\x01\x12\x11\n\tts_millis\x18\x03 \x01(\r\"\x94\x01\n\tFaultType\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x08\n\x04NONE\x10\x01\x12\x1e\n\x1aINRUSH_CURRENT_NOT_SETTLED\x10\x02\x12\x16\n\x12SPLITFLAP_SHUTDOWN\x10\x03\x12\x10\n\x0cOUT_OF_RANGE\x10\x04\x12\x10\n\x0cOVER_CURRENT\x10\x05\x12\x14\n\x10UNEXPECTED_POWER\x10\x06\"\x84\x01\n\x05State\x12\x0b\n\x07UNKNOWN\x10\x00\x12\x1b\n\x17STARTING_VERIFY_PSU_OFF\x10\x01\x12\x1c\n\x18STARTING_VERIFY_VOLTAGES\x10\x02\x12\x1c\n\x18STARTING_ENABLE_CHANNELS\x10\x03\x12\n\n\x06NORMAL\x10\x04\x12\t\n\x05\x46\x41ULT\x10\x05\"M\n\x0bMotionTrace\x12\x15\n\x06module\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\x16\n\x06\x65vents\x18\x02 \x03(\x07\x42\x06\x92?\x03\x10\x80\x01\x12\x0f\n\x07stopped\x18\x03 \x01(\x08\"\xd3\x01\n\rFromSplitflap\x12-\n\x0fsplitflap_state\x18\x01 \x01(\x0b\x32\x12.PB.SplitflapStateH\x00\x12\x16\n\x03log\x18\x02 \x01(\x0b\x32\x07.PB.LogH\x00\x12\x16\n\x03\x61\x63k\x18\x03 \x01(\x0b\x32\x07.PB.AckH\x00\x12/\n\x10supervisor_state\x18\x04 \x01(\x0b\x32\x13.PB.SupervisorStateH\x00\x12\'\n\x0cmotion_trace\x18\x05 \x01(\x0b\x32\x0f.PB.MotionTraceH\x00\x42\t\n\x07payload\"\xc9\x02\n\x10SplitflapCommand\x12;\n\x07modules\x18\x02 \x03(\x0b\x32\".PB.SplitflapCommand.ModuleCommandB\x06\x92?\x03\x10\xff\x01\x12\x1b\n\x13synchronize_arrival\x18\x03 \x01(\x08\x12$\n\x15\x61rrival_spread_millis\x18\x04 \x01(\rB\x05\x92?\x02\x38\x10\x1a\xb4\x01\n\rModuleCommand\x12\x39\n\x06\x61\x63tion\x18\x01 \x01(\x0e\x32).PB.SplitflapCommand.ModuleCommand.Action\x12\x14\n\x05param\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\"R\n\x06\x41\x63tion\x12\t\n\x05NO_OP\x10\x00\x12\x0e\n\nGO_TO_FLAP\x10\x01\x12\x12\n\x0eRESET_AND_HOME\x10\x02\x12\x19\n\x15\x43\x41LIBRATE_HOME_OFFSET\x10\x03\"\xb9\x01\n\x0fSplitflapConfig\x12\x39\n\x07modules\x18\x01 \x03(\x0b\x32 .PB.SplitflapConfig.ModuleConfigB\x06\x92?\x03\x10\xff\x01\x1ak\n\x0cModuleConfig\x12 \n\x11target_flap_index\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1d\n\x0emovement_nonce\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1a\n\x0breset_nonce\x18\x03 \x01(\rB\x05\x92?\x02\x38\x08\"\x0e\n\x0cRequestState\"+\n\x12RequestMotionTrace\x12\x15\n\x06module\x18\x01 \x01(\rB\x05\x92?\x02\x38\x08\"g\n\x13\x41\x63\x63\x65lerationProfile\x12\'\n\x12\x61\x63\x63\x65l_step_periods\x18\x01 \x03(\rB\x0b\x92?\x03\x10\xc0\x02\x92?\x02\x38\x10\x12\'\n\x12\x64\x65\x63\x65l_step_periods\x18\x02 \x03(\rB\x0b\x92?\x03\x10\xc0\x02\x92?\x02\x38\x10\"\x90\x02\n\x0cMotionConfig\x12\x35\n\x14\x61\x63\x63\x65leration_profile\x18\x01 \x01(\x0b\x32\x17.PB.AccelerationProfile\x12)\n\x14module_speed_percent\x18\x02 \x03(\rB\x0b\x92?\x03\x10\xff\x01\x92?\x02\x38\x08\x12;\n\x10module_idle_hold\x18\x03 \x03(\x0b\x32\x19.PB.MotionConfig.IdleHoldB\x06\x92?\x03\x10\xff\x01\x1a\x61\n\x08IdleHold\x12\x1c\n\rsettle_millis\x18\x01 \x01(\rB\x05\x92?\x02\x38\x10\x12\x1b\n\x0chold_percent\x18\x02 \x01(\rB\x05\x92?\x02\x38\x08\x12\x1a\n\x0bhold_millis\x18\x03 \x01(\rB\x05\x92?\x02\x38\x10\"\x9e\x01\n\x11SplitflapSequence\x12\x32\n\x06\x66rames\x18\x01 \x03(\x0b\x32\x1b.PB.SplitflapSequence.FrameB\x05\x92?\x02\x10\x08\x12\x0e\n\x06\x61ppend\x18\x02 \x01(\x08\x1a\x45\n\x05\x46rame\x12\x1f\n\nflap_index\x18\x01 \x03(\rB\x0b\x92?\x03\x10\xff\x01\x92?\x02\x38\x08\x12\x1b\n\x0c\x64well_millis\x18\x02 \x01(\rB\x05\x92?\x02\x38\x10\"\x98\x01\n\x12\x46lapAlphabetConfig\x12\x39\n\talphabets\x18\x01 \x03(\x0b\x32\x1f.PB.FlapAlphabetConfig.AlphabetB\x05\x92?\x02\x10\x04\x12$\n\x0fmodule_alphabet\x18\x02 \x03(\rB\x0b\x92?\x03\x10\xff\x01\x92?\x02\x38\x08\x1a!\n\x08\x41lphabet\x12\x15\n\x05\x66laps\x18\x01 \x01(\tB\x06\x92?\x03p\xff\x01\"\x86\x03\n\x0bToSplitflap\x12\r\n\x05nonce\x18\x01 \x01(\r\x12\x31\n\x11splitflap_command\x18\x02 \x01(\x0b\x32\x14.PB.SplitflapCommandH\x00\x12/\n\x10splitflap_config\x18\x03 \x01(\x0b\x32\x13.PB.SplitflapConfigH\x00\x12)\n\rrequest_state\x18\x04 \x01(\x0b\x32\x10.PB.RequestStateH\x00\x12)\n\rmotion_config\x18\x05 \x01(\x0b\x32\x10.PB.MotionConfigH\x00\x12\x33\n\x12splitflap_sequence\x18\x06 \x01(\x0b\x32\x15.PB.SplitflapSequenceH\x00\x12\x36\n\x14\x66lap_alphabet_config\x18\x07 \x01(\x0b\x32\x16.PB.FlapAlphabetConfigH\x00\x12\x36\n\x14request_motion_trace\x18\x08 \x01(\x0b\x32\x16.PB.RequestMotionTraceH\x00\x42\t\n\x07payloadb\x06proto3')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'splitflap_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _SPLITFLAPSTATE_MODULESTATE.fields_by_name['flap_index']._options = None
+  _SPLITFLAPSTATE_MODULESTATE.fields_by_name['flap_index']._serialized_options = b'\222?\0028\010'
+  _SPLITFLAPSTATE_MODULESTATE.fields_by_name['count_unexpected_home']._options = None
+  _SPLITFLAPSTATE_MODULESTATE.fields_by_name['count_unexpected_home']._serialized_options = b'\222?\0028\010'
+  _SPLITFLAPSTATE_MODULESTATE.fields_by_name['count_missed_home']._options = None
+  _SPLITFLAPSTATE_MODULESTATE.fields_by_name['count_missed_home']._serialized_options = b'\222?\0028\010'
+  _SPLITFLAPSTATE_MODULESTATE.fields_by_name['max_accel_step']._options = None
+  _SPLITFLAPSTATE_MODULESTATE.fields_by_name['max_accel_step']._serialized_options = b'\222?\0028\020'
+  _SPLITFLAPSTATE_MODULESTATE.fields_by_name['eta_millis']._options = None
+  _SPLITFLAPSTATE_MODULESTATE.fields_by_name['eta_millis']._serialized_options = b'\222?\0028\020'
+  _SPLITFLAPSTATE.fields_by_name['modules']._options = None
+  _SPLITFLAPSTATE.fields_by_name['modules']._serialized_options = b'\222?\003\020\377\001'
+  _LOG.fields_by_name['msg']._options = None
+  _LOG.fields_by_name['msg']._serialized_options = b'\222?\003p\377\001'
+  _SUPERVISORSTATE_FAULTINFO.fields_by_name['msg']._options = None
+  _SUPERVISORSTATE_FAULTINFO.fields_by_name['msg']._serialized_options = b'\222?\003p\377\001'
+  _SUPERVISORSTATE.fields_by_name['power_channels']._options = None
+  _SUPERVISORSTATE.fields_by_name['power_channels']._serialized_options = b'\222?\002\020\005'
+  _MOTIONTRACE.fields_by_name['module']._options = None
+  _MOTIONTRACE.fields_by_name['module']._serialized_options = b'\222?\0028\010'
+  _MOTIONTRACE.fields_by_name['events']._options = None
+  _MOTIONTRACE.fields_by_name['events']._serialized_options = b'\222?\003\020\200\001'
+  _SPLITFLAPCOMMAND_MODULECOMMAND.fields_by_name['param']._options = None
+  _SPLITFLAPCOMMAND_MODULECOMMAND.fields_by_name['param']._serialized_options = b'\222?\0028\010'
+  _SPLITFLAPCOMMAND.fields_by_name['modules']._options = None
+  _SPLITFLAPCOMMAND.fields_by_name['modules']._serialized_options = b'\222?\003\020\377\001'
+  _SPLITFLAPCOMMAND.fields_by_name['arrival_spread_millis']._options = None
+  _SPLITFLAPCOMMAND.fields_by_name['arrival_spread_millis']._serialized_options = b'\222?\0028\020'
+  _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['target_flap_index']._options = None
+  _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['target_flap_index']._serialized_options = b'\222?\0028\010'
+  _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['movement_nonce']._options = None
+  _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['movement_nonce']._serialized_options = b'\222?\0028\010'
+  _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['reset_nonce']._options = None
+  _SPLITFLAPCONFIG_MODULECONFIG.fields_by_name['reset_nonce']._serialized_options = b'\222?\0028\010'
+  _SPLITFLAPCONFIG.fields_by_name['modules']._options = None
+  _SPLITFLAPCONFIG.fields_by_name['modules']._serialized_options = b'\222?\003\020\377\001'
+  _REQUESTMOTIONTRACE.fields_by_name['module']._options = None
+  _REQUESTMOTIONTRACE.fields_by_name['module']._serialized_options = b'\222?\0028\010'
+  _ACCELERATIONPROFILE.fields_by_name['accel_step_periods']._options = None
+  _ACCELERATIONPROFILE.fields_by_name['accel_step_periods']._serialized_options = b'\222?\003\020\300\002\222?\0028\020'
+  _ACCELERATIONPROFILE.fields_by_name['decel_step_periods']._options = None
+  _ACCELERATIONPROFILE.fields_by_name['decel_step_periods']._serialized_options = b'\222?\003\020\300\002\222?\0028\020'
+  _MOTIONCONFIG_IDLEHOLD.fields_by_name['settle_millis']._options = None
+  _MOTIONCONFIG_IDLEHOLD.fields_by_name['settle_millis']._serialized_options = b'\222?\0028\020'
+  _MOTIONCONFIG_IDLEHOLD.fields_by_name['hold_percent']._options = None
+  _MOTIONCONFIG_IDLEHOLD.fields_by_name['hold_percent']._serialized_options = b'\222?\0028\010'
+  _MOTIONCONFIG_IDLEHOLD.fields_by_name['hold_millis']._options = None
+  _MOTIONCONFIG_IDLEHOLD.fields_by_name['hold_millis']._serialized_options = b'\222?\0028\020'
+  _MOTIONCONFIG.fields_by_name['module_speed_percent']._options = None
+  _MOTIONCONFIG.fields_by_name['module_speed_percent']._serialized_options = b'\222?\003\020\377\001\222?\0028\010'
+  _MOTIONCONFIG.fields_by_name['module_idle_hold']._options = None
+  _MOTIONCONFIG.fields_by_name['module_idle_hold']._serialized_options = b'\222?\003\020\377\001'
+  _SPLITFLAPSEQUENCE_FRAME.fields_by_name['flap_index']._options = None
+  _SPLITFLAPSEQUENCE_FRAME.fields_by_name['flap_index']._serialized_options = b'\222?\003\020\377\001\222?\0028\010'
+  _SPLITFLAPSEQUENCE_FRAME.fields_by_name['dwell_millis']._options = None
+  _SPLITFLAPSEQUENCE_FRAME.fields_by_name['dwell_millis']._serialized_options = b'\222?\0028\020'
+  _SPLITFLAPSEQUENCE.fields_by_name['frames']._options = None
+  _SPLITFLAPSEQUENCE.fields_by_name['frames']._serialized_options = b'\222?\002\020\010'
+  _FLAPALPHABETCONFIG_ALPHABET.fields_by_name['flaps']._options = None
+  _FLAPALPHABETCONFIG_ALPHABET.fields_by_name['flaps']._serialized_options = b'\222?\003p\377\001'
+  _FLAPALPHABETCONFIG.fields_by_name['alphabets']._options = None
+  _FLAPALPHABETCONFIG.fields_by_name['alphabets']._serialized_options = b'\222?\002\020\004'
+  _FLAPALPHABETCONFIG.fields_by_name['module_alphabet']._options = None
+  _FLAPALPHABETCONFIG.fields_by_name['module_alphabet']._serialized_options = b'\222?\003\020\377\001\222?\0028\010'
+  _SPLITFLAPSTATE._serialized_start=38
+  _SPLITFLAPSTATE._serialized_end=578
+  _SPLITFLAPSTATE_MODULESTATE._serialized_start=114
+  _SPLITFLAPSTATE_MODULESTATE._serialized_end=578
+  _SPLITFLAPSTATE_MODULESTATE_STATE._serialized_start=428
+  _SPLITFLAPSTATE_MODULESTATE_STATE._serialized_end=515
+  _SPLITFLAPSTATE_MODULESTATE_COILS._serialized_start=517
+  _SPLITFLAPSTATE_MODULESTATE_COILS._serialized_end=578
+  _LOG._serialized_start=580
+  _LOG._serialized_end=606
+  _ACK._serialized_start=608
+  _ACK._serialized_end=628
+  _SUPERVISORSTATE._serialized_start=631
+  _SUPERVISORSTATE._serialized_end=1307
+  _SUPERVISORSTATE_POWERCHANNELSTATE._serialized_start=836
+  _SUPERVISORSTATE_POWERCHANNELSTATE._serialized_end=912
+  _SUPERVISORSTATE_FAULTINFO._serialized_start=915
+  _SUPERVISORSTATE_FAULTINFO._serialized_end=1172
+  _SUPERVISORSTATE_FAULTINFO_FAULTTYPE._serialized_start=1024
+  _SUPERVISORSTATE_FAULTINFO_FAULTTYPE._serialized_end=1172
+  _SUPERVISORSTATE_STATE._serialized_start=1175
+  _SUPERVISORSTATE_STATE._serialized_end=1307
+  _MOTIONTRACE._serialized_start=1309
+  _MOTIONTRACE._serialized_end=1386
+  _FROMSPLITFLAP._serialized_start=1389
+  _FROMSPLITFLAP._serialized_end=1600
+  _SPLITFLAPCOMMAND._serialized_start=1603
+  _SPLITFLAPCOMMAND._serialized_end=1932
+  _SPLITFLAPCOMMAND_MODULECOMMAND._serialized_start=1752
+  _SPLITFLAPCOMMAND_MODULECOMMAND._serialized_end=1932
+  _SPLITFLAPCOMMAND_MODULECOMMAND_ACTION._serialized_start=1850
+  _SPLITFLAPCOMMAND_MODULECOMMAND_ACTION._serialized_end=1932
+  _SPLITFLAPCONFIG._serialized_start=1935
+  _SPLITFLAPCONFIG._serialized_end=2120
+  _SPLITFLAPCONFIG_MODULECONFIG._serialized_start=2013
+  _SPLITFLAPCONFIG_MODULECONFIG._serialized_end=2120
+  _REQUESTSTATE._serialized_start=2122
+  _REQUESTSTATE._serialized_end=2136
+  _REQUESTMOTIONTRACE._serialized_start=2138
+  _REQUESTMOTIONTRACE._serialized_end=2181
+  _ACCELERATIONPROFILE._serialized_start=2183
+  _ACCELERATIONPROFILE._serialized_end=2286
+  _MOTIONCONFIG._serialized_start=2289
+  _MOTIONCONFIG._serialized_end=2561
+  _MOTIONCONFIG_IDLEHOLD._serialized_start=2464
+  _MOTIONCONFIG_IDLEHOLD._serialized_end=2561
+  _SPLITFLAPSEQUENCE._serialized_start=2564
+  _SPLITFLAPSEQUENCE._serialized_end=2722
+  _SPLITFLAPSEQUENCE_FRAME._serialized_start=2653
+  _SPLITFLAPSEQUENCE_FRAME._serialized_end=2722
+  _FLAPALPHABETCONFIG._serialized_start=2725
+  _FLAPALPHABETCONFIG._serialized_end=2877
+  _FLAPALPHABETCONFIG_ALPHABET._serialized_start=2844
+  _FLAPALPHABETCONFIG_ALPHABET._serialized_end=2877
+  _TOSPLITFLAP._serialized_start=2880
+  _TOSPLITFLAP._serialized_end=3270
 # @@protoc_insertion_point(module_scope)
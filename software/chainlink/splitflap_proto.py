@@ -257,6 +257,12 @@ class Splitflap(object):
         message.request_state.SetInParent()
         self._enqueue_message(message)
 
+    def request_motion_trace(self, module):
+        """Asks for a module's motion trace, which arrives as a 'motion_trace' message (see motion_trace.py)."""
+        message = splitflap_pb2.ToSplitflap()
+        message.request_motion_trace.module = module
+        self._enqueue_message(message)
+
     def hard_reset(self):
         self._serial.setRTS(True)
         self._serial.setDTR(False)